@@ -18,7 +18,7 @@ endif
 TARGET_DIR = ../../bin
 
 BUILD_C_FLAGS   += -I.
-BUILD_CXX_FLAGS += -I. -I../../dpf/distrho -I../../dpf/dgl -I./Common/Structures -I./Common/Widgets -I./Common/Utils -I./Resources -I./Config -I./Libs/inih -I./Libs/DSPFilters/include
+BUILD_CXX_FLAGS += -I. -I../../dpf/distrho -I../../dpf/dgl -I./Common/Structures -I./Common/Widgets -I./Common/Utils -I./Structures -I./Resources -I./Config -I./Libs/inih -I./Libs/DSPFilters/include
 
 ifeq ($(HAVE_DGL),true)
 BASE_FLAGS += -DHAVE_DGL
@@ -85,6 +85,7 @@ clean:
 	rm -f Common/Widgets/src/*.d Common/Widgets/src/*.o
 	rm -f Common/Utils/Fonts/getchunk
 	rm -f Common/Utils/src/*.d Common/Utils/src/*.o
+	rm -f Structures/src/*.d Structures/src/*.o
 	rm -f Resources/Fonts/*.d Resources/Fonts/*.o
 	rm -f Config/src/*.d Config/src/*.o
 	rm -f Libs/inih/*.d Libs/inih/*.o
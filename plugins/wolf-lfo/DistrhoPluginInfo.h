@@ -13,8 +13,9 @@
 #define DISTRHO_PLUGIN_USES_MODGUI     0
 #define DISTRHO_UI_USE_NANOVG          1
 #define DISTRHO_PLUGIN_WANT_STATE      1
-#define DISTRHO_PLUGIN_WANT_FULL_STATE 0
+#define DISTRHO_PLUGIN_WANT_FULL_STATE 1
 #define DISTRHO_PLUGIN_WANT_TIMEPOS    1
+#define DISTRHO_PLUGIN_WANT_LATENCY    1
 #define DISTRHO_PLUGIN_LV2_CATEGORY "lv2:EnvelopePlugin" //is that the most appropriate category?
 
 #endif // DISTRHO_PLUGIN_INFO_H_INCLUDED
@@ -84,12 +84,16 @@ private:
 
 // Half-band analog prototypes (s-plane)
 
+// design() returns false if the root finder did not converge. The
+// layout then holds the best estimates and is designed again next time.
+// The setup() functions below pass the result on.
+
 class AnalogLowPass : public LayoutBase
 {
 public:
   AnalogLowPass ();
 
-  void design (const int numPoles,
+  bool design (const int numPoles,
                WorkspaceBase* w);
 
 private:
@@ -103,7 +107,7 @@ class AnalogLowShelf : public LayoutBase
 public:
   AnalogLowShelf ();
 
-  void design (int numPoles,
+  bool design (int numPoles,
                double gainDb,
                WorkspaceBase* w);
 
@@ -118,7 +122,7 @@ private:
 
 struct LowPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               WorkspaceBase* w);
@@ -126,7 +130,7 @@ struct LowPassBase : PoleFilterBase <AnalogLowPass>
 
 struct HighPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               WorkspaceBase* w);
@@ -134,7 +138,7 @@ struct HighPassBase : PoleFilterBase <AnalogLowPass>
 
 struct BandPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency,
@@ -143,7 +147,7 @@ struct BandPassBase : PoleFilterBase <AnalogLowPass>
 
 struct BandStopBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency,
@@ -152,7 +156,7 @@ struct BandStopBase : PoleFilterBase <AnalogLowPass>
 
 struct LowShelfBase : PoleFilterBase <AnalogLowShelf>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               double gainDb,
@@ -168,81 +172,81 @@ struct LowShelfBase : PoleFilterBase <AnalogLowShelf>
 template <int MaxOrder>
 struct LowPass : PoleFilter <LowPassBase, MaxOrder>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency)
   {
     Workspace <MaxOrder> w;
-    LowPassBase::setup (order,
-                        sampleRate,
-                        cutoffFrequency,
-                        &w);
+    return LowPassBase::setup (order,
+                               sampleRate,
+                               cutoffFrequency,
+                               &w);
   }
 };
 
 template <int MaxOrder>
 struct HighPass : PoleFilter <HighPassBase, MaxOrder>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency)
   {
     Workspace <MaxOrder> w;
-    HighPassBase::setup (order,
-                         sampleRate,
-                         cutoffFrequency,
-                         &w);
+    return HighPassBase::setup (order,
+                                sampleRate,
+                                cutoffFrequency,
+                                &w);
   }
 };
 
 template <int MaxOrder>
 struct BandPass : PoleFilter <BandPassBase, MaxOrder, MaxOrder*2>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency)
   {
     Workspace <MaxOrder> w;
-    BandPassBase::setup (order,
-                         sampleRate,
-                         centerFrequency,
-                         widthFrequency,
-                         &w);
+    return BandPassBase::setup (order,
+                                sampleRate,
+                                centerFrequency,
+                                widthFrequency,
+                                &w);
   }
 };
 
 template <int MaxOrder>
 struct BandStop : PoleFilter <BandStopBase, MaxOrder, MaxOrder*2>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency)
   {
     Workspace <MaxOrder> w;
-    BandStopBase::setup (order,
-                         sampleRate,
-                         centerFrequency,
-                         widthFrequency,
-                         &w);
+    return BandStopBase::setup (order,
+                                sampleRate,
+                                centerFrequency,
+                                widthFrequency,
+                                &w);
   }
 };
 
 template <int MaxOrder>
 struct LowShelf : PoleFilter <LowShelfBase, MaxOrder, MaxOrder*2>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               double gainDb)
   {
     Workspace <MaxOrder> w;
-    LowShelfBase::setup (order,
-                         sampleRate,
-                         cutoffFrequency,
-                         gainDb,
-                         &w);
+    return LowShelfBase::setup (order,
+                                sampleRate,
+                                cutoffFrequency,
+                                gainDb,
+                                &w);
   }
 };
 
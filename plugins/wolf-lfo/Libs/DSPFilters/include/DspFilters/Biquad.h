@@ -62,14 +62,41 @@ public:
     {
       return static_cast<Sample> (StateType::process1 (in, b, ac()));
     }
+
+    template <typename Sample>
+    void processBlock (int numSamples, Sample* dest, const BiquadBase& b)
+    {
+      if (numSamples <= 0)
+        return;
+
+      processBlock1 (numSamples, dest, *static_cast<StateType*> (this), b, ac());
+
+      // leave ac() where the per sample path would have left it
+      if ((numSamples & 1) == 0)
+        ac();
+    }
   };
 
 public:
   // Calculate filter response at the given normalized frequency.
   complex_t response (double normalizedFrequency) const;
 
+  // Same for count frequencies at once, see stagesResponse().
+  void response (const double* normalizedFrequencies,
+                 complex_t* responses,
+                 int count) const;
+
+  // Magnitude of the response, cheaper than taking abs() of response().
+  void magnitudeResponse (const double* normalizedFrequencies,
+                          double* magnitudes,
+                          int count) const;
+
   std::vector<PoleZeroPair> getPoleZeros () const;
 
+  // Same without allocating. Writes at most maxPairs pairs and returns
+  // how many were written.
+  int getPoleZeros (PoleZeroPair* pairs, int maxPairs) const;
+
   double getA0 () const { return m_a0; }
   double getA1 () const { return m_a1*m_a0; }
   double getA2 () const { return m_a2*m_a0; }
@@ -77,14 +104,18 @@ public:
   double getB1 () const { return m_b1*m_a0; }
   double getB2 () const { return m_b2*m_a0; }
 
+  // Same interface as Cascade, so SmoothedFilterDesign can interpolate
+  // between designs of either kind.
+  int getNumStages () const { return 1; }
+  bool isStable () const;
+  void copyStages (const BiquadBase& other) { *this = other; }
+  void interpolateStages (const BiquadBase& from, const BiquadBase& to, double t);
+
   // Process a block of samples in the given form
   template <class StateType, typename Sample>
   void process (int numSamples, Sample* dest, StateType& state) const
   {
-    while (--numSamples >= 0) {
-      *dest = state.process (*dest, *this);
-      dest++;
-    }
+    state.processBlock (numSamples, dest, *this);
   }
 
 protected:
@@ -126,6 +157,106 @@ public:
 
 //------------------------------------------------------------------------------
 
+/*
+ * Evaluates the response of numStages sections in series at count
+ * normalized frequencies. Fills either responses or magnitudes, the
+ * other one may be null.
+ *
+ * Frequencies are done in blocks with plain arrays of doubles, so the
+ * inner loops vectorize. z^-1 is computed once per frequency and
+ * z^-2 is its square, shared by all the stages.
+ *
+ */
+template <class Stage>
+void stagesResponse (const Stage* stages,
+                     int numStages,
+                     const double* normalizedFrequencies,
+                     complex_t* responses,
+                     double* magnitudes,
+                     int count)
+{
+  const int blockSize = 64;
+
+  double c1 [blockSize], s1 [blockSize]; // z^-1
+  double c2 [blockSize], s2 [blockSize]; // z^-2
+  double re [blockSize], im [blockSize]; // numerator, or squared magnitude
+  double dre[blockSize], dim[blockSize]; // denominator
+
+  for (int start = 0; start < count; start += blockSize)
+  {
+    const int n = std::min (blockSize, count - start);
+    const double* f = normalizedFrequencies + start;
+
+    for (int i = 0; i < n; ++i)
+    {
+      const double w = 2 * doublePi * f[i];
+      c1[i] = cos (w);
+      s1[i] = -sin (w);
+      c2[i] = c1[i] * c1[i] - s1[i] * s1[i];
+      s2[i] = 2 * c1[i] * s1[i];
+      re[i] = 1;
+      im[i] = 0;
+      dre[i] = 1;
+      dim[i] = 0;
+    }
+
+    for (int k = 0; k < numStages; ++k)
+    {
+      const BiquadBase& s = stages[k];
+      const double b0 = s.m_b0, b1 = s.m_b1, b2 = s.m_b2;
+      const double a1 = s.m_a1, a2 = s.m_a2;
+
+      if (magnitudes)
+      {
+        for (int i = 0; i < n; ++i)
+        {
+          const double tre = b0 + b1 * c1[i] + b2 * c2[i];
+          const double tim =      b1 * s1[i] + b2 * s2[i];
+          const double bre = 1  + a1 * c1[i] + a2 * c2[i];
+          const double bim =      a1 * s1[i] + a2 * s2[i];
+          re[i]  *= tre * tre + tim * tim;
+          dre[i] *= bre * bre + bim * bim;
+        }
+      }
+      else
+      {
+        for (int i = 0; i < n; ++i)
+        {
+          const double tre = b0 + b1 * c1[i] + b2 * c2[i];
+          const double tim =      b1 * s1[i] + b2 * s2[i];
+          const double bre = 1  + a1 * c1[i] + a2 * c2[i];
+          const double bim =      a1 * s1[i] + a2 * s2[i];
+          const double nre = re[i] * tre - im[i] * tim;
+          const double nim = re[i] * tim + im[i] * tre;
+          const double ere = dre[i] * bre - dim[i] * bim;
+          const double eim = dre[i] * bim + dim[i] * bre;
+          re[i] = nre;
+          im[i] = nim;
+          dre[i] = ere;
+          dim[i] = eim;
+        }
+      }
+    }
+
+    if (magnitudes)
+    {
+      for (int i = 0; i < n; ++i)
+        magnitudes[start + i] = sqrt (re[i] / dre[i]);
+    }
+    else
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        const double d = dre[i] * dre[i] + dim[i] * dim[i];
+        responses[start + i] = complex_t ((re[i] * dre[i] + im[i] * dim[i]) / d,
+                                          (im[i] * dre[i] - re[i] * dim[i]) / d);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+
 // Expresses a biquad as a pair of pole/zeros, with gain
 // values so that the coefficients can be reconstructed precisely.
 struct BiquadPoleState : PoleZeroPair
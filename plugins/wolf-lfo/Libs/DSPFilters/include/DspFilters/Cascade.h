@@ -73,7 +73,57 @@ public:
       return static_cast<Sample> (out);
     }
 
+    // Processes the buffer in blocks of blockSize samples. Stages are
+    // run over the whole block in groups of up to four, with their
+    // coefficients and state held in locals. Samples are kept in double
+    // between stages, like process().
+    template <typename Sample>
+    void processBlock (int numSamples, Sample* dest, const Cascade& c)
+    {
+      double block [blockSize];
+
+      while (numSamples > 0)
+      {
+        const int n = std::min (numSamples, int (blockSize));
+
+        for (int i = 0; i < n; ++i)
+          block[i] = dest[i];
+
+        StateType* state = m_stateArray;
+        Biquad const* stage = c.m_stageArray;
+        double vsa = ac();
+        int stages = c.m_numStages;
+        for (; stages >= 4; stages -= 4, state += 4, stage += 4, vsa = 0)
+          processBlock4 (n, block, state, stage, vsa);
+        if (stages >= 2)
+        {
+          processBlock2 (n, block, state, stage, vsa);
+          stages -= 2;
+          state += 2;
+          stage += 2;
+          vsa = 0;
+        }
+        if (stages > 0)
+          processBlock1 (n, block, *state, *stage, vsa);
+
+        // leave ac() where the per sample path would have left it
+        if ((n & 1) == 0)
+          ac();
+
+        for (int i = 0; i < n; ++i)
+          dest[i] = static_cast<Sample> (block[i]);
+
+        dest += n;
+        numSamples -= n;
+      }
+    }
+
   protected:
+    enum
+    {
+      blockSize = 64
+    };
+
     StateBase (StateType* stateArray)
       : m_stateArray (stateArray)
     {
@@ -83,6 +133,108 @@ public:
     StateType* m_stateArray;
   };
 
+  // Processes up to 8 channels together, one SIMD lane per channel
+  template <int Lanes>
+  class LanesStateBase : private DenormalPrevention
+  {
+  public:
+    typedef DirectFormIILanes <Lanes> StateType;
+    typedef typename StateType::Vector Vector;
+
+    enum
+    {
+      Width = Vector::size,
+      Groups = (Lanes + Width - 1) / Width
+    };
+
+    int getNumChannels () const
+    {
+      return Lanes;
+    }
+
+    // Same blocking as StateBase::processBlock(). Each group of Width
+    // channels is gathered into vectors and runs through its own states,
+    // one group after the other like the channels of a ChannelsState.
+    template <typename Sample>
+    void process (int numSamples,
+                  Sample* const* arrayOfChannels,
+                  const Cascade& c)
+    {
+      Vector block [Groups][blockSize];
+      double lanes [blockSize][Groups * Width];
+      int offset = 0;
+
+      while (numSamples > 0)
+      {
+        const int n = std::min (numSamples, int (blockSize));
+
+        // the padding lanes are cleared for every block, the store
+        // below leaves their outputs in them
+        for (int j = 0; j < Groups * Width; ++j)
+          for (int i = 0; i < n; ++i)
+            lanes[i][j] = j < Lanes ? arrayOfChannels[j][offset + i] : 0;
+
+        for (int g = 0; g < Groups; ++g)
+          for (int i = 0; i < n; ++i)
+            block[g][i] = Vector::load (lanes[i] + g * Width);
+
+        const double blockVsa = ac();
+
+        for (int g = 0; g < Groups; ++g)
+        {
+          StateType* state = m_stateArray + g * m_maxStages;
+          Biquad const* stage = c.m_stageArray;
+          double vsa = blockVsa;
+          int stages = c.m_numStages;
+          for (; stages >= 4; stages -= 4, state += 4, stage += 4, vsa = 0)
+            processBlock4 (n, block[g], state, stage, vsa);
+          if (stages >= 2)
+          {
+            processBlock2 (n, block[g], state, stage, vsa);
+            stages -= 2;
+            state += 2;
+            stage += 2;
+            vsa = 0;
+          }
+          if (stages > 0)
+            processBlock1 (n, block[g], *state, *stage, vsa);
+        }
+
+        // leave ac() where the per sample path would have left it
+        if ((n & 1) == 0)
+          ac();
+
+        for (int g = 0; g < Groups; ++g)
+          for (int i = 0; i < n; ++i)
+            block[g][i].store (lanes[i] + g * Width);
+
+        for (int j = 0; j < Lanes; ++j)
+          for (int i = 0; i < n; ++i)
+            arrayOfChannels[j][offset + i] = static_cast<Sample> (lanes[i][j]);
+
+        offset += n;
+        numSamples -= n;
+      }
+    }
+
+  protected:
+    enum
+    {
+      blockSize = 64
+    };
+
+    // the states of group g start at stateArray + g * maxStages
+    LanesStateBase (StateType* stateArray, int maxStages)
+      : m_stateArray (stateArray)
+      , m_maxStages (maxStages)
+    {
+    }
+
+  protected:
+    StateType* m_stateArray;
+    int m_maxStages;
+  };
+
   struct Stage : Biquad
   {
   };
@@ -114,16 +266,38 @@ public:
   // Calculate filter response at the given normalized frequency.
   complex_t response (double normalizedFrequency) const;
 
+  // Same for count frequencies at once, see stagesResponse().
+  void response (const double* normalizedFrequencies,
+                 complex_t* responses,
+                 int count) const;
+
+  // Magnitude of the response, cheaper than taking abs() of response().
+  void magnitudeResponse (const double* normalizedFrequencies,
+                          double* magnitudes,
+                          int count) const;
+
   std::vector<PoleZeroPair> getPoleZeros () const;
 
+  // Same without allocating. Writes at most maxPairs pairs and returns
+  // how many were written.
+  int getPoleZeros (PoleZeroPair* pairs, int maxPairs) const;
+
+  // Returns true if the poles of every stage are inside the unit circle.
+  bool isStable () const;
+
+  // Copies the stages of another cascade.
+  void copyStages (const Cascade& other);
+
+  // Sets the coefficients of every stage to a linear blend between two
+  // cascades with the same number of stages, t going from 0 to 1.
+  // If both are stable, so is the blend.
+  void interpolateStages (const Cascade& from, const Cascade& to, double t);
+
   // Process a block of samples in the given form
   template <class StateType, typename Sample>
   void process (int numSamples, Sample* dest, StateType& state) const
   {
-    while (--numSamples >= 0) {
-      *dest = state.process (*dest, *this);
-      dest++;
-    }
+    state.processBlock (numSamples, dest, *this);
   }
 
 protected:
@@ -135,6 +309,8 @@ protected:
   void setLayout (const LayoutBase& proto);
 
 private:
+  friend class DesignCache;
+
   int m_numStages;
   int m_maxStages;
   Stage* m_stageArray;
@@ -168,6 +344,35 @@ public:
     StateType m_states[MaxStages];
   };
 
+  template <int Lanes>
+  class LanesState : public Cascade::LanesStateBase <Lanes>
+  {
+  public:
+    typedef Cascade::LanesStateBase <Lanes> base_type;
+
+    LanesState() : base_type (m_states, MaxStages)
+    {
+      reset ();
+    }
+
+    void reset ()
+    {
+      for (int i = 0; i < base_type::Groups * MaxStages; ++i)
+        m_states[i].reset();
+    }
+
+    template <class Filter, typename Sample>
+    void process (int numSamples,
+                  Sample* const* arrayOfChannels,
+                  Filter& filter)
+    {
+      base_type::process (numSamples, arrayOfChannels, filter);
+    }
+
+  private:
+    DirectFormIILanes <Lanes> m_states[base_type::Groups * MaxStages];
+  };
+
   /*@Internal*/
   Cascade::Storage getCascadeStorage()
   {
@@ -0,0 +1,130 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_CHAIN_H
+#define DSPFILTERS_CHAIN_H
+
+#include "DspFilters/Common.h"
+
+namespace Dsp {
+
+/*
+ * FilterChain
+ *
+ * Runs two filters in series on the same buffers. Both are members, so
+ * the chain needs no allocation and every call is resolved at compile
+ * time and can be inlined. Chains nest, to build longer ones:
+ *
+ *  // Anti-alias low pass followed by a DC blocker, stereo
+ *  FilterChain <SimpleFilter <Butterworth::LowPass <8>, 2>,
+ *               SimpleFilter <Custom::OnePole, 2> > f;
+ *
+ *  f.first().setup (8, 4 * sampleRate, 0.45 * sampleRate);
+ *  f.second().setup (1, 0.995, 1);
+ *  f.process (numSamples, arrayOfChannels);
+ *
+ * First and Second can be SimpleFilter, SimpleLanesFilter or another
+ * FilterChain, and must have the same number of channels. Audio goes
+ * through both in blocks of 64 samples, so the second filter reads
+ * data that is still in cache.
+ *
+ * Like the filters it holds, a chain must not be copied once set up.
+ *
+ */
+template <class First,
+          class Second>
+class FilterChain
+{
+public:
+  enum
+  {
+    NumChannels = First::NumChannels
+  };
+
+  First& first ()
+  {
+    return m_first;
+  }
+
+  Second& second ()
+  {
+    return m_second;
+  }
+
+  int getNumChannels()
+  {
+    return NumChannels;
+  }
+
+  void reset ()
+  {
+    m_first.reset ();
+    m_second.reset ();
+  }
+
+  template <typename Sample>
+  void process (int numSamples, Sample* const* arrayOfChannels)
+  {
+    const int blockSize = 64;
+
+    Sample* channels [NumChannels];
+    for (int i = 0; i < NumChannels; ++i)
+      channels[i] = arrayOfChannels[i];
+
+    while (numSamples > 0)
+    {
+      const int n = std::min (blockSize, numSamples);
+
+      m_first.process (n, channels);
+      m_second.process (n, channels);
+
+      for (int i = 0; i < NumChannels; ++i)
+        channels[i] += n;
+      numSamples -= n;
+    }
+  }
+
+private:
+  // Fails to compile when the channel counts differ
+  typedef char channelsMustMatch [int (First::NumChannels) ==
+                                  int (Second::NumChannels) ? 1 : -1];
+
+  First m_first;
+  Second m_second;
+};
+
+}
+
+#endif
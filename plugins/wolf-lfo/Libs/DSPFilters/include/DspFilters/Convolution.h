@@ -0,0 +1,140 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_CONVOLUTION_H
+#define DSPFILTERS_CONVOLUTION_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Fft.h"
+#include "DspFilters/Types.h"
+
+namespace Dsp {
+
+/*
+ * PartitionedConvolution
+ *
+ * Uniformly partitioned overlap-save convolution. The impulse is cut
+ * into partitions of blockSize samples, each one transformed once when
+ * the impulse is set. Every blockSize input samples, one FFT of size
+ * 2 * blockSize is done per pair of channels and multiplied with all
+ * the partitions through a frequency domain delay line, so the cost per
+ * sample grows with the impulse length only through the complex
+ * multiply-adds.
+ *
+ * Since the impulse is real, two channels share one complex FFT: one
+ * in the real part, the other in the imaginary part.
+ *
+ * The output is delayed by getLatency() == blockSize samples.
+ *
+ */
+class PartitionedConvolution
+{
+public:
+  PartitionedConvolution ();
+
+  // blockSize must be a power of two. This is the only call that
+  // allocates, maxLength is the longest impulse setImpulse() will take.
+  void setup (int blockSize, int maxLength, int numChannels);
+
+  // Replaces the impulse, keeping the signal history.
+  void setImpulse (const double* impulse, int length);
+
+  int getBlockSize () const
+  {
+    return m_blockSize;
+  }
+
+  int getLatency () const
+  {
+    return m_blockSize;
+  }
+
+  void reset ();
+
+  template <typename Sample>
+  void process (int numSamples, Sample* const* arrayOfChannels)
+  {
+    int done = 0;
+
+    while (done < numSamples)
+    {
+      const int n = std::min (numSamples - done, m_blockSize - m_position);
+
+      for (int i = 0; i < m_numChannels; ++i)
+      {
+        Sample* dest = arrayOfChannels[i] + done;
+        double* in = &m_input[i * m_blockSize + m_position];
+        const double* out = &m_output[i * m_blockSize + m_position];
+
+        for (int j = 0; j < n; ++j)
+        {
+          in[j] = dest[j];
+          dest[j] = static_cast<Sample> (out[j]);
+        }
+      }
+
+      done += n;
+      m_position += n;
+
+      if (m_position == m_blockSize)
+      {
+        processBlock ();
+        m_position = 0;
+      }
+    }
+  }
+
+private:
+  void processBlock ();
+
+  int m_blockSize;
+  int m_numChannels;
+  int m_numPartitions;
+  int m_maxPartitions;
+  int m_position;
+  int m_delayPosition;
+
+  Fft m_fft;
+  std::vector<double> m_input;
+  std::vector<double> m_previous;
+  std::vector<double> m_output;
+  std::vector<complex_t> m_partitions;
+  std::vector<complex_t> m_delayLine;
+  std::vector<complex_t> m_buffer;
+};
+
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_DESIGNCACHE_H
+#define DSPFILTERS_DESIGNCACHE_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Cascade.h"
+#include "DspFilters/Filter.h"
+#include "DspFilters/Layout.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+namespace Dsp {
+
+/*
+ * Process-wide cache of filter designs.
+ *
+ * Holds two tables: analog prototypes keyed by family and order, which
+ * saves the root finder for Bessel and Legendre, and the final biquad
+ * coefficients of a design keyed by its name and quantized parameters.
+ *
+ * Lookups are lock-free and never block. Stores take a lock, but only
+ * if it is free, otherwise the result is simply not cached. Both tables
+ * are fixed size and replace the least recently used entry when full.
+ *
+ */
+class DesignCache
+{
+public:
+  enum
+  {
+    maxPrototypePoles = 50,
+    maxStages = 25
+  };
+
+  static DesignCache& getInstance ();
+
+  // Keys are never 0, which marks an empty entry.
+  static uint64_t makePrototypeKey (const char* family, int numPoles);
+  static uint64_t hashName (const std::string& name);
+  static uint64_t makeDesignKey (uint64_t nameHash,
+                                 const Params& parameters,
+                                 int numParams);
+
+  bool findPrototype (uint64_t key, LayoutBase& layout);
+  void storePrototype (uint64_t key, const LayoutBase& layout);
+
+  bool findStages (uint64_t key, Cascade& cascade);
+  void storeStages (uint64_t key, const Cascade& cascade);
+
+private:
+  enum
+  {
+    prototypeEntries = 32,
+    stagesEntries = 256,
+    probeLength = 8,
+
+    prototypeValues = 3 + 8 * ((maxPrototypePoles + 1) / 2),
+    stagesValues = 1 + 6 * maxStages
+  };
+
+  // Seqlock protected entry. The sequence is odd while it is written.
+  template <int NumValues>
+  struct Entry
+  {
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> lastUsed;
+    std::atomic<uint64_t> key;
+    std::atomic<int> numValues;
+    std::atomic<double> values[NumValues];
+  };
+
+  template <int NumValues, int NumEntries>
+  struct Table
+  {
+    Entry<NumValues> entries[NumEntries];
+  };
+
+  DesignCache ();
+
+  template <int NumValues, int NumEntries>
+  bool find (Table<NumValues, NumEntries>& table,
+             uint64_t key, double* values);
+
+  template <int NumValues, int NumEntries>
+  void store (Table<NumValues, NumEntries>& table,
+              uint64_t key, const double* values, int numValues);
+
+  std::atomic<uint32_t> m_clock;
+  std::mutex m_writeMutex;
+
+  Table<prototypeValues, prototypeEntries> m_prototypes;
+  Table<stagesValues, stagesEntries> m_stages;
+
+  DesignCache (const DesignCache&);
+  DesignCache& operator= (const DesignCache&);
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * FilterDesign that looks up the coefficients of each setParams in the
+ * DesignCache before running the design. Only for designs made of a
+ * Cascade, which covers all the pole filters.
+ *
+ */
+template <class DesignClass,
+          int Channels = 0,
+          class StateType = DirectFormII>
+class CachedFilterDesign : public FilterDesign <DesignClass, Channels, StateType>
+{
+public:
+  CachedFilterDesign ()
+    : m_nameHash (DesignCache::hashName (this->m_design.getName ()))
+  {
+  }
+
+protected:
+  void doSetParams (const Params& parameters)
+  {
+    DesignCache& cache = DesignCache::getInstance ();
+
+    const uint64_t key = DesignCache::makeDesignKey (m_nameHash,
+                                                     parameters,
+                                                     DesignClass::NumParams);
+
+    if (!cache.findStages (key, this->m_design))
+    {
+      this->m_design.setParams (parameters);
+      cache.storeStages (key, this->m_design);
+    }
+  }
+
+private:
+  const uint64_t m_nameHash;
+};
+
+}
+
+#endif
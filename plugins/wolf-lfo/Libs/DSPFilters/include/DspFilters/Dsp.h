@@ -44,7 +44,13 @@ THE SOFTWARE.
 
 #include "DspFilters/Biquad.h"
 #include "DspFilters/Cascade.h"
+#include "DspFilters/Chain.h"
+#include "DspFilters/Convolution.h"
+#include "DspFilters/DesignCache.h"
+#include "DspFilters/Fft.h"
 #include "DspFilters/Filter.h"
+#include "DspFilters/HalfBand.h"
+#include "DspFilters/LinearPhase.h"
 #include "DspFilters/PoleFilter.h"
 #include "DspFilters/SmoothedFilter.h"
 #include "DspFilters/State.h"
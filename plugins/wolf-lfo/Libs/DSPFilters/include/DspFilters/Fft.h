@@ -0,0 +1,80 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_FFT_H
+#define DSPFILTERS_FFT_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Types.h"
+
+namespace Dsp {
+
+/*
+ * Fft
+ *
+ * In-place radix-2 complex FFT. setup() builds the twiddle and bit
+ * reversal tables and is the only call that allocates, so transforms
+ * can run on the audio thread.
+ *
+ */
+class Fft
+{
+public:
+  Fft ();
+
+  // size must be a power of two
+  void setup (int size);
+
+  int getSize () const
+  {
+    return m_size;
+  }
+
+  void forward (complex_t* data) const;
+
+  // Includes the 1/size scaling, so inverse (forward (x)) == x
+  void inverse (complex_t* data) const;
+
+private:
+  void transform (complex_t* data, bool inverse) const;
+
+  int m_size;
+  std::vector<int> m_bitReverse;
+  std::vector<complex_t> m_twiddles;
+};
+
+}
+
+#endif
@@ -101,9 +101,30 @@ public:
   void copyParamsFrom (Dsp::Filter const* other);
 
   virtual std::vector<PoleZeroPair> getPoleZeros() const = 0;
+
+  // Real-time safe version of getPoleZeros(). Writes at most maxPairs
+  // pairs and returns how many were written.
+  virtual int getPoleZeros (PoleZeroPair* pairs, int maxPairs) const = 0;
  
   virtual complex_t response (double normalizedFrequency) const = 0;
 
+  // Evaluates count frequencies in one call, for plots and analyzers.
+  // See log_frequencies() to make a log spaced set.
+  virtual void response (const double* normalizedFrequencies,
+                         complex_t* responses,
+                         int count) const = 0;
+
+  virtual void magnitudeResponse (const double* normalizedFrequencies,
+                                  double* magnitudes,
+                                  int count) const = 0;
+
+  // Delay in samples that the host should compensate for. Zero for the
+  // IIR filters, see LinearPhaseFilterDesign.
+  virtual int getLatency () const
+  {
+    return 0;
+  }
+
   virtual int getNumChannels() = 0;
   virtual void reset () = 0;
   virtual void process (int numSamples, float* const* arrayOfChannels) = 0;
@@ -173,12 +194,31 @@ public:
   {
     return m_design.getPoleZeros();
   }
+
+  int getPoleZeros (PoleZeroPair* pairs, int maxPairs) const
+  {
+    return m_design.getPoleZeros (pairs, maxPairs);
+  }
  
   complex_t response (double normalizedFrequency) const
   {
     return m_design.response (normalizedFrequency);
   }
 
+  void response (const double* normalizedFrequencies,
+                 complex_t* responses,
+                 int count) const
+  {
+    m_design.response (normalizedFrequencies, responses, count);
+  }
+
+  void magnitudeResponse (const double* normalizedFrequencies,
+                          double* magnitudes,
+                          int count) const
+  {
+    m_design.magnitudeResponse (normalizedFrequencies, magnitudes, count);
+  }
+
 protected:
   void doSetParams (const Params& parameters)
   {
@@ -243,6 +283,11 @@ template <class FilterClass,
 class SimpleFilter : public FilterClass
 {
 public:
+  enum
+  {
+    NumChannels = Channels
+  };
+
   int getNumChannels()
   {
     return Channels;
@@ -264,6 +309,45 @@ protected:
                  typename FilterClass::template State <StateType> > m_state;
 };
 
+//------------------------------------------------------------------------------
+
+/*
+ * Same as SimpleFilter, but all channels are processed together, one
+ * SIMD lane per channel, instead of one channel after the other.
+ * Only works with filters made of a Cascade (the pole filters). Best
+ * suited to 2, 4 or 8 channels.
+ *
+ */
+template <class FilterClass,
+          int Channels>
+class SimpleLanesFilter : public FilterClass
+{
+public:
+  enum
+  {
+    NumChannels = Channels
+  };
+
+  int getNumChannels()
+  {
+    return Channels;
+  }
+
+  void reset ()
+  {
+    m_state.reset();
+  }
+
+  template <typename Sample>
+  void process (int numSamples, Sample* const* arrayOfChannels)
+  {
+    m_state.process (numSamples, arrayOfChannels, *((FilterClass*)this));
+  }
+
+protected:
+  typename FilterClass::template LanesState <Channels> m_state;
+};
+
 }
 
 #endif
@@ -0,0 +1,225 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_HALFBAND_H
+#define DSPFILTERS_HALFBAND_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Simd.h"
+
+namespace Dsp {
+
+/*
+ * Polyphase half-band resampling
+ *
+ * A half-band filter made of two allpass branches, each a cascade of
+ * first order sections in z^-2:
+ *
+ *  H(z) = 0.5 * (A0(z^2) + z^-1 A1(z^2))
+ *
+ * Split into its polyphase components, both branches run at the low
+ * rate: upsampling computes one output sample per branch, downsampling
+ * feeds one input sample to each branch and averages them. Nothing is
+ * computed for samples that would be discarded or are known to be
+ * zero. The two branches are independent, so they run side by side in
+ * the two lanes of a double2.
+ *
+ * The coefficients come from the elliptic design in
+ * "Digital Signal Processing Schemes for Efficient Interpolation and
+ * Decimation" by Valenzuela and Constantinides.
+ *
+ */
+
+class HalfBandStage
+{
+public:
+  enum
+  {
+    maxCoefficients = 32
+  };
+
+  HalfBandStage ();
+
+  // Designs the fewest coefficients that reach the stopband attenuation
+  // in dB for a transition band of the given width, normalized to the
+  // high sample rate and in (0, 0.5).
+  void setup (double attenuation, double transition);
+
+  int getNumCoefficients () const
+  {
+    return m_numCoefficients;
+  }
+
+  // At DC, in samples of the high rate
+  double getGroupDelay () const;
+
+  void reset ();
+
+  // Writes 2 * numSamples samples to dest. Use separate stages for
+  // upsampling and downsampling, they keep their own state.
+  void upsample (int numSamples, double* dest, const double* src);
+
+  // Reads 2 * numSamples samples from src.
+  void downsample (int numSamples, double* dest, const double* src);
+
+private:
+  // With an odd count the last coefficient has no partner in the
+  // second branch, so its section runs on the first branch alone.
+  double processLastSection (double x)
+  {
+    const double y = m_lastCoefficient * (x - m_lastY) + m_lastX;
+    m_lastX = x;
+    m_lastY = y;
+    return y;
+  }
+
+  int m_numCoefficients;
+  int m_numSections;
+
+  // lane 0 is the first branch, lane 1 the second
+  double2 m_coefficients[maxCoefficients / 2];
+  double2 m_x[maxCoefficients / 2];
+  double2 m_y[maxCoefficients / 2];
+
+  double m_lastCoefficient;
+  double m_lastX;
+  double m_lastY;
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * Oversamples by 2, 4, 8 or 16 with a chain of half-band stages. The
+ * first stage needs the sharpest filter, the later ones only have to
+ * reject images of content that the first stage already limited, so
+ * they use wider transitions and fewer coefficients.
+ *
+ * The quality trades latency and CPU for steepness:
+ *
+ *  qualityLow    : 70 dB, transition 0.1
+ *  qualityMedium : 100 dB, transition 0.05
+ *  qualityHigh   : 140 dB, transition 0.02
+ *
+ * Usage:
+ *
+ *  oversampler.setup (4, HalfBandOversampler::qualityMedium, 2, 512);
+ *  double* const* up = oversampler.upsample (numSamples, inputs);
+ *  // process 4 * numSamples samples of each up[channel] in place
+ *  oversampler.downsample (numSamples, outputs);
+ *
+ */
+class HalfBandOversampler
+{
+public:
+  enum Quality
+  {
+    qualityLow,
+    qualityMedium,
+    qualityHigh
+  };
+
+  enum
+  {
+    maxStages = 4
+  };
+
+  HalfBandOversampler ();
+
+  // This is the only call that allocates.
+  void setup (int factor, Quality quality, int numChannels, int maxBlockSize);
+
+  int getFactor () const
+  {
+    return 1 << m_numStages;
+  }
+
+  // Up and down round trip delay at DC, in samples of the base rate.
+  // Not a whole number in general, round it when reporting to a host.
+  double getLatency () const;
+
+  void reset ();
+
+  template <typename Sample>
+  double* const* upsample (int numSamples, const Sample* const* input)
+  {
+    assert (numSamples <= m_maxBlockSize);
+
+    for (int c = 0; c < m_numChannels; ++c)
+    {
+      double* src = getBuffer (c, 1);
+      for (int i = 0; i < numSamples; ++i)
+        src[i] = input[c][i];
+
+      const int which = upsampleChannel (c, numSamples);
+      m_result[c] = getBuffer (c, which);
+    }
+
+    return &m_result[0];
+  }
+
+  template <typename Sample>
+  void downsample (int numSamples, Sample* const* output)
+  {
+    for (int c = 0; c < m_numChannels; ++c)
+    {
+      const double* dest = downsampleChannel (c, numSamples);
+      for (int i = 0; i < numSamples; ++i)
+        output[c][i] = static_cast<Sample> (dest[i]);
+    }
+  }
+
+private:
+  double* getBuffer (int channel, int which)
+  {
+    return &m_buffers[(2 * channel + which) * m_bufferSize];
+  }
+
+  int upsampleChannel (int channel, int numSamples);
+  const double* downsampleChannel (int channel, int numSamples);
+
+  int m_numStages;
+  int m_numChannels;
+  int m_maxBlockSize;
+  int m_bufferSize;
+
+  std::vector<HalfBandStage> m_up;
+  std::vector<HalfBandStage> m_down;
+  std::vector<double> m_buffers;
+  std::vector<double*> m_result;
+};
+
+}
+
+#endif
@@ -142,6 +142,8 @@ public:
   }
 
 private:
+  friend class DesignCache;
+
   int m_numPoles;
   int m_maxPoles;
   PoleZeroPair* m_pair;
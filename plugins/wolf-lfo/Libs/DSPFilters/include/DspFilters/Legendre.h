@@ -153,7 +153,10 @@ class AnalogLowPass : public LayoutBase
 public:
   AnalogLowPass ();
 
-  void design (const int numPoles, WorkspaceBase* w);
+  // Returns false if the root finder did not converge. The layout then
+  // holds the best estimates and is designed again next time.
+  // The setup() functions below pass the result on.
+  bool design (const int numPoles, WorkspaceBase* w);
 
 private:
   int m_numPoles;
@@ -165,7 +168,7 @@ private:
 
 struct LowPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               WorkspaceBase* w);
@@ -173,7 +176,7 @@ struct LowPassBase : PoleFilterBase <AnalogLowPass>
 
 struct HighPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency,
               WorkspaceBase* w);
@@ -181,7 +184,7 @@ struct HighPassBase : PoleFilterBase <AnalogLowPass>
 
 struct BandPassBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency,
@@ -190,7 +193,7 @@ struct BandPassBase : PoleFilterBase <AnalogLowPass>
 
 struct BandStopBase : PoleFilterBase <AnalogLowPass>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency,
@@ -206,64 +209,64 @@ struct BandStopBase : PoleFilterBase <AnalogLowPass>
 template <int MaxOrder>
 struct LowPass : PoleFilter <LowPassBase, MaxOrder>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency)
   {
     Workspace <MaxOrder> w;
-    LowPassBase::setup (order,
-                        sampleRate,
-                        cutoffFrequency,
-                        &w);
+    return LowPassBase::setup (order,
+                               sampleRate,
+                               cutoffFrequency,
+                               &w);
   }
 };
 
 template <int MaxOrder>
 struct HighPass : PoleFilter <HighPassBase, MaxOrder>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double cutoffFrequency)
   {
     Workspace <MaxOrder> w;
-    HighPassBase::setup (order,
-                         sampleRate,
-                         cutoffFrequency,
-                         &w);
+    return HighPassBase::setup (order,
+                                sampleRate,
+                                cutoffFrequency,
+                                &w);
   }
 };
 
 template <int MaxOrder>
 struct BandPass : PoleFilter <BandPassBase, MaxOrder, MaxOrder*2>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency)
   {
     Workspace <MaxOrder> w;
-    BandPassBase::setup (order,
-                         sampleRate,
-                         centerFrequency,
-                         widthFrequency,
-                         &w);
+    return BandPassBase::setup (order,
+                                sampleRate,
+                                centerFrequency,
+                                widthFrequency,
+                                &w);
   }
 };
 
 template <int MaxOrder>
 struct BandStop : PoleFilter <BandStopBase, MaxOrder, MaxOrder*2>
 {
-  void setup (int order,
+  bool setup (int order,
               double sampleRate,
               double centerFrequency,
               double widthFrequency)
   {
     Workspace <MaxOrder> w;
-    BandStopBase::setup (order,
-                         sampleRate,
-                         centerFrequency,
-                         widthFrequency,
-                         &w);
+    return BandStopBase::setup (order,
+                                sampleRate,
+                                centerFrequency,
+                                widthFrequency,
+                                &w);
   }
 };
 
@@ -0,0 +1,215 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_LINEARPHASE_H
+#define DSPFILTERS_LINEARPHASE_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Convolution.h"
+#include "DspFilters/Fft.h"
+#include "DspFilters/Filter.h"
+#include "DspFilters/Types.h"
+
+namespace Dsp {
+
+/*
+ * LinearPhaseKernel
+ *
+ * Designs a symmetric FIR with a given magnitude response. The caller
+ * fills getMagnitudes() at getFrequencies(), then design() makes the
+ * zero phase impulse with an inverse FFT, centers it and applies a
+ * Blackman window. The delay is getDelay() samples at all frequencies.
+ *
+ */
+class LinearPhaseKernel
+{
+public:
+  LinearPhaseKernel ();
+
+  // Rounded up to an odd length so the delay is a whole number of
+  // samples. This is the only call that allocates.
+  void setup (int length);
+
+  int getLength () const
+  {
+    return m_length;
+  }
+
+  int getDelay () const
+  {
+    return (m_length - 1) / 2;
+  }
+
+  int getNumFrequencies () const
+  {
+    return int (m_frequencies.size ());
+  }
+
+  // Normalized, evenly spaced from 0 to 0.5
+  const double* getFrequencies () const
+  {
+    return &m_frequencies[0];
+  }
+
+  double* getMagnitudes ()
+  {
+    return &m_magnitudes[0];
+  }
+
+  void design ();
+
+  const double* getTaps () const
+  {
+    return &m_taps[0];
+  }
+
+  complex_t response (double normalizedFrequency) const;
+
+private:
+  int m_length;
+  Fft m_fft;
+  std::vector<double> m_frequencies;
+  std::vector<double> m_magnitudes;
+  std::vector<double> m_window;
+  std::vector<double> m_taps;
+  std::vector<complex_t> m_buffer;
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * LinearPhaseFilterDesign
+ *
+ * Same parameters and magnitude response as FilterDesign, but realized
+ * as a linear phase FIR run through PartitionedConvolution. Every
+ * frequency is delayed by the same amount, which getLatency() reports
+ * so the host can compensate:
+ *
+ *  blockSize + (length - 1) / 2
+ *
+ * A longer kernel follows the IIR magnitude more closely at low
+ * frequencies, a smaller block lowers the latency at a higher cost per
+ * sample. Changing parameters redesigns the kernel without allocating,
+ * but the switch is not smoothed.
+ *
+ */
+template <class DesignClass,
+          int Channels>
+class LinearPhaseFilterDesign : public FilterDesignBase <DesignClass>
+{
+public:
+  explicit LinearPhaseFilterDesign (int length = 2047, int blockSize = 256)
+  {
+    m_kernel.setup (length);
+    m_convolution.setup (blockSize, m_kernel.getLength (), Channels);
+  }
+
+  int getLatency () const
+  {
+    return m_convolution.getLatency () + m_kernel.getDelay ();
+  }
+
+  // A FIR has no poles to show
+  std::vector<PoleZeroPair> getPoleZeros() const
+  {
+    return std::vector<PoleZeroPair> ();
+  }
+
+  int getPoleZeros (PoleZeroPair* /*pairs*/, int /*maxPairs*/) const
+  {
+    return 0;
+  }
+
+  // Response of the kernel, the block latency is not included
+  complex_t response (double normalizedFrequency) const
+  {
+    return m_kernel.response (normalizedFrequency);
+  }
+
+  void response (const double* normalizedFrequencies,
+                 complex_t* responses,
+                 int count) const
+  {
+    for (int i = 0; i < count; ++i)
+      responses[i] = m_kernel.response (normalizedFrequencies[i]);
+  }
+
+  void magnitudeResponse (const double* normalizedFrequencies,
+                          double* magnitudes,
+                          int count) const
+  {
+    for (int i = 0; i < count; ++i)
+      magnitudes[i] = std::abs (m_kernel.response (normalizedFrequencies[i]));
+  }
+
+  int getNumChannels()
+  {
+    return Channels;
+  }
+
+  void reset ()
+  {
+    m_convolution.reset ();
+  }
+
+  void process (int numSamples, float* const* arrayOfChannels)
+  {
+    m_convolution.process (numSamples, arrayOfChannels);
+  }
+
+  void process (int numSamples, double* const* arrayOfChannels)
+  {
+    m_convolution.process (numSamples, arrayOfChannels);
+  }
+
+protected:
+  void doSetParams (const Params& parameters)
+  {
+    FilterDesignBase<DesignClass>::doSetParams (parameters);
+
+    this->m_design.magnitudeResponse (m_kernel.getFrequencies (),
+                                      m_kernel.getMagnitudes (),
+                                      m_kernel.getNumFrequencies ());
+    m_kernel.design ();
+    m_convolution.setImpulse (m_kernel.getTaps (), m_kernel.getLength ());
+  }
+
+  LinearPhaseKernel m_kernel;
+  PartitionedConvolution m_convolution;
+};
+
+}
+
+#endif
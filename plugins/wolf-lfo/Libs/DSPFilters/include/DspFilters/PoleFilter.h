@@ -77,6 +77,15 @@ public:
       vpz.push_back (m_digitalProto[i]);
     return vpz;
   }
+
+  int getPoleZeros (PoleZeroPair* pairs, int maxPairs) const
+  {
+    const int numPairs = std::min ((m_digitalProto.getNumPoles () + 1) / 2,
+                                   maxPairs);
+    for (int i = 0; i < numPairs; ++i)
+      pairs[i] = m_digitalProto[i];
+    return numPairs;
+  }
 #endif
 
 protected:
@@ -0,0 +1,81 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_PROTOTYPETABLES_H
+#define DSPFILTERS_PROTOTYPETABLES_H
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Types.h"
+#include "DspFilters/Layout.h"
+
+namespace Dsp {
+
+/*
+ * Precomputed half-band analog low pass prototypes for the common
+ * orders 2, 4 and 8. These only depend on the family and the order,
+ * so they are generated ahead of time by Tools/GeneratePrototypeTables
+ * ("make prototype-tables") and the design code only needs the root
+ * finder for other orders.
+ *
+ * Define DSPFILTERS_NO_PROTOTYPE_TABLES to always design at run time.
+ *
+ */
+
+enum PrototypeFamily
+{
+  prototypeButterworth,
+  prototypeBessel,
+  prototypeLegendre
+};
+
+// Fills the layout with the prototype and returns true, or returns
+// false and leaves the layout alone if the order is not tabulated.
+bool loadPrototypeTable (PrototypeFamily family,
+                         int numPoles,
+                         LayoutBase& layout);
+
+// Same for the elliptic prototypes, which also depend on the ripple
+// and the rolloff. Orders 2, 4 and 8 are tabulated for a ripple of
+// 0.01, 0.1, 0.5, 1 or 3 dB and a whole rolloff from -4 to 4, the
+// other values are designed at run time. Leaves the normal gain to
+// the caller.
+bool loadEllipticPrototypeTable (int numPoles,
+                                 double rippleDb,
+                                 double rolloff,
+                                 LayoutBase& layout);
+
+}
+
+#endif
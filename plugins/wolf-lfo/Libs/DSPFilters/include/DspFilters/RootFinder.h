@@ -67,7 +67,11 @@ public:
   // The input coefficients are set using coef()[].
   // The solutions are placed in roots.
   //
-  void solve (int degree,
+  // Returns false if a root did not converge within the iteration
+  // limit. The roots are still filled in with the best estimates, and
+  // nothing is allocated or thrown, so this is safe on the audio thread.
+  //
+  bool solve (int degree,
               bool polish = true,
               bool doSort = true);
 
@@ -93,7 +97,8 @@ public:
 private:
   // Improves x as a root using Laguerre's method.
   // The input coefficient array has degree+1 elements.
-  void laguerre (int degree,
+  // Returns false if x did not converge.
+  bool laguerre (int degree,
                  complex_t a[],
                  complex_t& x,
                  int& its);
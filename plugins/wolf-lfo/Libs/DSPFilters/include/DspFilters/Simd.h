@@ -0,0 +1,315 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_SIMD_H
+#define DSPFILTERS_SIMD_H
+
+#include "DspFilters/Common.h"
+
+//
+// Minimal portable wrappers around SIMD registers, used by the lane
+// states and the block kernels. Falls back to plain scalar code when
+// the target has no suitable instruction set.
+//
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define DSPFILTERS_SIMD_SSE2 1
+#  include <emmintrin.h>
+#  if defined(__AVX2__)
+#    define DSPFILTERS_SIMD_AVX2 1
+#    include <immintrin.h>
+#  endif
+#endif
+
+namespace Dsp {
+
+// Two packed doubles
+struct double2
+{
+  static const int size = 2;
+
+#if DSPFILTERS_SIMD_SSE2
+  __m128d v;
+
+  static inline double2 make (__m128d v)
+  {
+    double2 r;
+    r.v = v;
+    return r;
+  }
+
+  static inline double2 set1 (double x) { return make (_mm_set1_pd (x)); }
+  static inline double2 set (double lo, double hi) { return make (_mm_set_pd (hi, lo)); }
+  static inline double2 zero () { return make (_mm_setzero_pd ()); }
+  static inline double2 load (const double* p) { return make (_mm_loadu_pd (p)); }
+  inline void store (double* p) const { _mm_storeu_pd (p, v); }
+
+  friend inline double2 operator+ (double2 a, double2 b) { return make (_mm_add_pd (a.v, b.v)); }
+  friend inline double2 operator- (double2 a, double2 b) { return make (_mm_sub_pd (a.v, b.v)); }
+  friend inline double2 operator* (double2 a, double2 b) { return make (_mm_mul_pd (a.v, b.v)); }
+
+#else
+  double v[2];
+
+  static inline double2 set (double lo, double hi)
+  {
+    double2 r;
+    r.v[0] = lo;
+    r.v[1] = hi;
+    return r;
+  }
+
+  static inline double2 set1 (double x) { return set (x, x); }
+  static inline double2 zero () { return set (0, 0); }
+  static inline double2 load (const double* p) { return set (p[0], p[1]); }
+  inline void store (double* p) const { p[0] = v[0]; p[1] = v[1]; }
+
+  friend inline double2 operator+ (double2 a, double2 b) { return set (a.v[0] + b.v[0], a.v[1] + b.v[1]); }
+  friend inline double2 operator- (double2 a, double2 b) { return set (a.v[0] - b.v[0], a.v[1] - b.v[1]); }
+  friend inline double2 operator* (double2 a, double2 b) { return set (a.v[0] * b.v[0], a.v[1] * b.v[1]); }
+
+#endif
+};
+
+#if DSPFILTERS_SIMD_SSE2
+
+// Four packed floats. Only there when the target has vector registers,
+// the buffer routines in Utilities.h use the scalar templates otherwise.
+struct float4
+{
+  static const int size = 4;
+
+  __m128 v;
+
+  static inline float4 make (__m128 v)
+  {
+    float4 r;
+    r.v = v;
+    return r;
+  }
+
+  static inline float4 set1 (float x) { return make (_mm_set1_ps (x)); }
+  static inline float4 load (const float* p) { return make (_mm_loadu_ps (p)); }
+  inline void store (float* p) const { _mm_storeu_ps (p, v); }
+
+  friend inline float4 operator+ (float4 a, float4 b) { return make (_mm_add_ps (a.v, b.v)); }
+  friend inline float4 operator- (float4 a, float4 b) { return make (_mm_sub_ps (a.v, b.v)); }
+  friend inline float4 operator* (float4 a, float4 b) { return make (_mm_mul_ps (a.v, b.v)); }
+
+};
+
+//
+// Lane shuffles for the buffer routines. zip() interleaves a and b into
+// lo and hi, unzip() is its inverse. reverse() flips the lane order.
+// vabs() and vmax() work lane by lane, and are named apart from the
+// scalar functions so they never take part in their overload sets.
+//
+
+inline void zip (float4 a, float4 b, float4& lo, float4& hi)
+{
+  lo.v = _mm_unpacklo_ps (a.v, b.v);
+  hi.v = _mm_unpackhi_ps (a.v, b.v);
+}
+
+inline void unzip (float4 lo, float4 hi, float4& a, float4& b)
+{
+  a.v = _mm_shuffle_ps (lo.v, hi.v, _MM_SHUFFLE (2, 0, 2, 0));
+  b.v = _mm_shuffle_ps (lo.v, hi.v, _MM_SHUFFLE (3, 1, 3, 1));
+}
+
+inline float4 reverse (float4 a)
+{
+  return float4::make (_mm_shuffle_ps (a.v, a.v, _MM_SHUFFLE (0, 1, 2, 3)));
+}
+
+inline void zip (double2 a, double2 b, double2& lo, double2& hi)
+{
+  lo.v = _mm_unpacklo_pd (a.v, b.v);
+  hi.v = _mm_unpackhi_pd (a.v, b.v);
+}
+
+inline double2 reverse (double2 a)
+{
+  return double2::make (_mm_shuffle_pd (a.v, a.v, 1));
+}
+
+inline float4 vabs (float4 a) { return float4::make (_mm_andnot_ps (_mm_set1_ps (-0.f), a.v)); }
+inline float4 vmax (float4 a, float4 b) { return float4::make (_mm_max_ps (a.v, b.v)); }
+inline double2 vabs (double2 a) { return double2::make (_mm_andnot_pd (_mm_set1_pd (-0.), a.v)); }
+inline double2 vmax (double2 a, double2 b) { return double2::make (_mm_max_pd (a.v, b.v)); }
+
+// A 2x2 transpose is its own inverse
+inline void unzip (double2 lo, double2 hi, double2& a, double2& b)
+{
+  zip (lo, hi, a, b);
+}
+
+#if DSPFILTERS_SIMD_AVX2
+
+// Eight packed floats
+struct float8
+{
+  static const int size = 8;
+
+  __m256 v;
+
+  static inline float8 make (__m256 v)
+  {
+    float8 r;
+    r.v = v;
+    return r;
+  }
+
+  static inline float8 set1 (float x) { return make (_mm256_set1_ps (x)); }
+  static inline float8 load (const float* p) { return make (_mm256_loadu_ps (p)); }
+  inline void store (float* p) const { _mm256_storeu_ps (p, v); }
+
+  friend inline float8 operator+ (float8 a, float8 b) { return make (_mm256_add_ps (a.v, b.v)); }
+  friend inline float8 operator- (float8 a, float8 b) { return make (_mm256_sub_ps (a.v, b.v)); }
+  friend inline float8 operator* (float8 a, float8 b) { return make (_mm256_mul_ps (a.v, b.v)); }
+};
+
+// Four packed doubles
+struct double4
+{
+  static const int size = 4;
+
+  __m256d v;
+
+  static inline double4 make (__m256d v)
+  {
+    double4 r;
+    r.v = v;
+    return r;
+  }
+
+  static inline double4 set1 (double x) { return make (_mm256_set1_pd (x)); }
+  static inline double4 load (const double* p) { return make (_mm256_loadu_pd (p)); }
+  inline void store (double* p) const { _mm256_storeu_pd (p, v); }
+
+  friend inline double4 operator+ (double4 a, double4 b) { return make (_mm256_add_pd (a.v, b.v)); }
+  friend inline double4 operator- (double4 a, double4 b) { return make (_mm256_sub_pd (a.v, b.v)); }
+  friend inline double4 operator* (double4 a, double4 b) { return make (_mm256_mul_pd (a.v, b.v)); }
+};
+
+// The unpack instructions work within 128 bit halves, so the halves
+// are swapped into place afterwards.
+inline void zip (float8 a, float8 b, float8& lo, float8& hi)
+{
+  const __m256 l = _mm256_unpacklo_ps (a.v, b.v);
+  const __m256 h = _mm256_unpackhi_ps (a.v, b.v);
+  lo.v = _mm256_permute2f128_ps (l, h, 0x20);
+  hi.v = _mm256_permute2f128_ps (l, h, 0x31);
+}
+
+inline void unzip (float8 lo, float8 hi, float8& a, float8& b)
+{
+  const __m256 l = _mm256_permute2f128_ps (lo.v, hi.v, 0x20);
+  const __m256 h = _mm256_permute2f128_ps (lo.v, hi.v, 0x31);
+  a.v = _mm256_shuffle_ps (l, h, _MM_SHUFFLE (2, 0, 2, 0));
+  b.v = _mm256_shuffle_ps (l, h, _MM_SHUFFLE (3, 1, 3, 1));
+}
+
+inline float8 reverse (float8 a)
+{
+  const __m256 r = _mm256_permute2f128_ps (a.v, a.v, 1);
+  return float8::make (_mm256_shuffle_ps (r, r, _MM_SHUFFLE (0, 1, 2, 3)));
+}
+
+inline void zip (double4 a, double4 b, double4& lo, double4& hi)
+{
+  const __m256d l = _mm256_unpacklo_pd (a.v, b.v);
+  const __m256d h = _mm256_unpackhi_pd (a.v, b.v);
+  lo.v = _mm256_permute2f128_pd (l, h, 0x20);
+  hi.v = _mm256_permute2f128_pd (l, h, 0x31);
+}
+
+inline void unzip (double4 lo, double4 hi, double4& a, double4& b)
+{
+  const __m256d l = _mm256_permute2f128_pd (lo.v, hi.v, 0x20);
+  const __m256d h = _mm256_permute2f128_pd (lo.v, hi.v, 0x31);
+  a.v = _mm256_unpacklo_pd (l, h);
+  b.v = _mm256_unpackhi_pd (l, h);
+}
+
+inline double4 reverse (double4 a)
+{
+  const __m256d r = _mm256_permute2f128_pd (a.v, a.v, 1);
+  return double4::make (_mm256_shuffle_pd (r, r, 0x5));
+}
+
+inline float8 vabs (float8 a) { return float8::make (_mm256_andnot_ps (_mm256_set1_ps (-0.f), a.v)); }
+inline float8 vmax (float8 a, float8 b) { return float8::make (_mm256_max_ps (a.v, b.v)); }
+inline double4 vabs (double4 a) { return double4::make (_mm256_andnot_pd (_mm256_set1_pd (-0.), a.v)); }
+inline double4 vmax (double4 a, double4 b) { return double4::make (_mm256_max_pd (a.v, b.v)); }
+
+#endif
+
+// Widest vector available for a sample type
+template <typename T>
+struct SimdVector;
+
+#if DSPFILTERS_SIMD_AVX2
+template <> struct SimdVector<float>  { typedef float8 type; };
+template <> struct SimdVector<double> { typedef double4 type; };
+#else
+template <> struct SimdVector<float>  { typedef float4 type; };
+template <> struct SimdVector<double> { typedef double2 type; };
+#endif
+
+#define DSPFILTERS_SIMD_BUFFERS 1
+
+#endif
+
+// Register the lane states group their channels in. Only doubles, so
+// the lanes round exactly like the per-channel states. One or two
+// channels fill a double2, more use double4 where AVX2 provides it.
+template <int Lanes, bool Wide = (Lanes > 2)>
+struct LaneVector
+{
+  typedef double2 type;
+};
+
+#if DSPFILTERS_SIMD_AVX2
+template <int Lanes>
+struct LaneVector <Lanes, true>
+{
+  typedef double4 type;
+};
+#endif
+
+}
+
+#endif
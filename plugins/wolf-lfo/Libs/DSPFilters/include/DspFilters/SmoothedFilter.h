@@ -44,6 +44,11 @@ namespace Dsp {
 /*
  * Implements smooth modulation of time-varying filter parameters
  *
+ * By default the filter is redesigned for every sample of a transition.
+ * With setControlInterval() it is only redesigned every few samples,
+ * and the coefficients are interpolated in between, which is much
+ * cheaper for continuously modulated parameters.
+ *
  */
 template <class DesignClass,
           int Channels,
@@ -59,7 +64,22 @@ public:
   SmoothedFilterDesign (int transitionSamples)
     : m_transitionSamples (transitionSamples)
     , m_remainingSamples (-1) // first time flag
+    , m_controlInterval (1)
+    , m_segmentLength (0)
+    , m_segmentPosition (0)
+  {
+  }
+
+  // Number of samples between two designs during a transition.
+  // 1 redesigns on every sample.
+  void setControlInterval (int controlInterval)
   {
+    m_controlInterval = std::max (1, controlInterval);
+  }
+
+  int getControlInterval () const
+  {
+    return m_controlInterval;
   }
 
   // Process a block of samples.
@@ -75,7 +95,16 @@ public:
     // first handle any transition samples
     int remainingSamples = std::min (m_remainingSamples, numSamples);
 
-    if (remainingSamples > 0)
+    if (remainingSamples > 0 && m_controlInterval > 1)
+    {
+      processInterpolated (remainingSamples, destChannelArray);
+
+      m_remainingSamples -= remainingSamples;
+
+      if (m_remainingSamples == 0)
+        m_transitionParams = this->getParams();
+    }
+    else if (remainingSamples > 0)
     {
       // interpolate parameters for each sample
       const double t = 1. / m_remainingSamples;
@@ -125,11 +154,90 @@ public:
   }
 
 protected:
+  // Processes transition samples, designing the filter at the end of
+  // each segment of m_controlInterval samples and interpolating the
+  // coefficients from the previous design point.
+  template <typename Sample>
+  void processInterpolated (int numSamples,
+                            Sample* const* destChannelArray)
+  {
+    const int numChannels = this->getNumChannels();
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+      if (m_segmentPosition == m_segmentLength)
+        beginSegment (m_remainingSamples - n);
+
+      ++m_segmentPosition;
+      m_interpolatedFilter.interpolateStages (m_segmentStart,
+                                              m_transitionFilter,
+                                              double (m_segmentPosition) / m_segmentLength);
+
+      for (int i = numChannels; --i >= 0;)
+      {
+        Sample* dest = destChannelArray[i]+n;
+        *dest = this->m_state[i].process (*dest, m_interpolatedFilter);
+      }
+    }
+
+    if (m_remainingSamples == numSamples)
+    {
+      // transition is over
+      m_segmentLength = 0;
+      m_segmentPosition = 0;
+    }
+  }
+
+  void beginSegment (int remainingSamples)
+  {
+    // start from the coefficients in use, if any
+    if (m_segmentLength > 0)
+      m_segmentStart.copyStages (m_interpolatedFilter);
+    else
+      m_segmentStart.setParams (m_transitionParams);
+
+    m_segmentLength = std::min (m_controlInterval, remainingSamples);
+    m_segmentPosition = 0;
+    m_segmentStartParams = m_transitionParams;
+
+    const double t = double (m_segmentLength) / remainingSamples;
+    for (int i = 0; i < DesignClass::NumParams; ++i)
+      m_transitionParams[i] += (this->getParams()[i] - m_transitionParams[i]) * t;
+
+    m_transitionFilter.setParams (m_transitionParams);
+
+    // Stability guard. Blends of two stable designs are stable, so it
+    // is enough to check the design points. Hold the last coefficients
+    // if the new design is unstable, and jump to the new design if the
+    // number of stages changed since the two can't be blended.
+    if (!m_transitionFilter.isStable() && m_segmentStart.isStable())
+      m_transitionFilter.copyStages (m_segmentStart);
+    else if (m_transitionFilter.getNumStages() != m_segmentStart.getNumStages() ||
+             !m_segmentStart.isStable())
+      m_segmentStart.copyStages (m_transitionFilter);
+  }
+
   void doSetParams (const Params& parameters)
   {
     if (m_remainingSamples >= 0)
     {
       m_remainingSamples = m_transitionSamples;
+
+      // cut the current segment short so the next one heads for
+      // the new parameters, starting from where this one got to
+      // rather than from its end point
+      if (m_segmentLength > 0)
+      {
+        const double t = double (m_segmentPosition) / m_segmentLength;
+        for (int i = 0; i < DesignClass::NumParams; ++i)
+          m_transitionParams[i] = m_segmentStartParams[i] +
+            (m_transitionParams[i] - m_segmentStartParams[i]) * t;
+      }
+
+      if (m_remainingSamples > 0)
+        m_segmentLength = m_segmentPosition;
+      else
+        m_segmentLength = m_segmentPosition = 0;
     }
     else
     {
@@ -147,6 +255,13 @@ protected:
   int m_transitionSamples;
 
   int m_remainingSamples;        // remaining transition samples
+
+  DesignClass m_segmentStart;         // design at the start of the segment
+  Params m_segmentStartParams;        // parameters at the start of the segment
+  DesignClass m_interpolatedFilter;   // coefficients in use
+  int m_controlInterval;
+  int m_segmentLength;
+  int m_segmentPosition;
 };
 
 }
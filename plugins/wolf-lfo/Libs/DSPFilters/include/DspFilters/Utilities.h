@@ -37,6 +37,7 @@ THE SOFTWARE.
 #define DSPFILTERS_UTILITIES_H
 
 #include "DspFilters/Common.h"
+#include "DspFilters/Simd.h"
 
 namespace Dsp {
 
@@ -45,8 +46,222 @@ namespace Dsp {
  *
  * These routines are handy for manipulating buffers of samples.
  *
+ * When the target has vector registers, the common cases (float or
+ * double on both sides, no skip) are overloaded with kernels that work
+ * a whole register at a time, see namespace detail below. Everything
+ * else goes through the scalar templates.
+ *
  */
 
+#if DSPFILTERS_SIMD_BUFFERS
+
+namespace detail {
+
+template <typename T>
+void simd_add (int samples, T* dest, T const* src)
+{
+  typedef typename SimdVector<T>::type V;
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    (V::load (dest + i) + V::load (src + i)).store (dest + i);
+  for (; i < samples; ++i)
+    dest[i] += src[i];
+}
+
+template <typename T>
+void simd_multiply (int samples, T* dest, T factor)
+{
+  typedef typename SimdVector<T>::type V;
+  const V f = V::set1 (factor);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    (V::load (dest + i) * f).store (dest + i);
+  for (; i < samples; ++i)
+    dest[i] *= factor;
+}
+
+// Lane k of the ramp holds k * dt. The gain of each block is computed
+// from the start rather than accumulated, so it may differ from the
+// scalar fade in the last bits.
+template <typename T>
+void simd_fade (int samples, T* dest, T start, T end)
+{
+  typedef typename SimdVector<T>::type V;
+  const T dt = (end - start) / samples;
+  T ramp [V::size];
+  for (int k = 0; k < V::size; ++k)
+    ramp[k] = k * dt;
+  const V r = V::load (ramp);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    (V::load (dest + i) * (V::set1 (start + i * dt) + r)).store (dest + i);
+  for (; i < samples; ++i)
+    dest[i] *= start + i * dt;
+}
+
+template <typename T>
+void simd_fade (int samples, T* dest, T const* src, T start, T end)
+{
+  typedef typename SimdVector<T>::type V;
+  const T dt = (end - start) / samples;
+  T ramp [V::size];
+  for (int k = 0; k < V::size; ++k)
+    ramp[k] = k * dt;
+  const V r = V::load (ramp);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+  {
+    const V d = V::load (dest + i);
+    const V t = V::set1 (start + i * dt) + r;
+    (d + t * (V::load (src + i) - d)).store (dest + i);
+  }
+  for (; i < samples; ++i)
+    dest[i] = dest[i] + (start + i * dt) * (src[i] - dest[i]);
+}
+
+template <typename T>
+void simd_interleave2 (int samples, T* dest, T const* left, T const* right)
+{
+  typedef typename SimdVector<T>::type V;
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+  {
+    V lo, hi;
+    zip (V::load (left + i), V::load (right + i), lo, hi);
+    lo.store (dest + 2 * i);
+    hi.store (dest + 2 * i + V::size);
+  }
+  for (; i < samples; ++i)
+  {
+    dest[2 * i] = left[i];
+    dest[2 * i + 1] = right[i];
+  }
+}
+
+template <typename T>
+void simd_deinterleave2 (int samples, T* left, T* right, T const* src)
+{
+  typedef typename SimdVector<T>::type V;
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+  {
+    V l, r;
+    unzip (V::load (src + 2 * i), V::load (src + 2 * i + V::size), l, r);
+    l.store (left + i);
+    r.store (right + i);
+  }
+  for (; i < samples; ++i)
+  {
+    left[i] = src[2 * i];
+    right[i] = src[2 * i + 1];
+  }
+}
+
+template <typename T>
+void simd_reverse (int samples, T* dest, T const* src)
+{
+  typedef typename SimdVector<T>::type V;
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    reverse (V::load (src + samples - i - V::size)).store (dest + i);
+  for (; i < samples; ++i)
+    dest[i] = src[samples - 1 - i];
+}
+
+template <typename T>
+void simd_to_mono (int samples, T* dest, T const* left, T const* right)
+{
+  typedef typename SimdVector<T>::type V;
+  const T gain = T(0.70710678118654752440084436210485);
+  const V g = V::set1 (gain);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    ((V::load (left + i) + V::load (right + i)) * g).store (dest + i);
+  for (; i < samples; ++i)
+    dest[i] = (left[i] + right[i]) * gain;
+}
+
+template <typename T>
+T simd_peak (int samples, T const* src)
+{
+  typedef typename SimdVector<T>::type V;
+  V m = V::set1 (0);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+    m = vmax (m, vabs (V::load (src + i)));
+  T lanes [V::size];
+  m.store (lanes);
+  T result = 0;
+  for (int k = 0; k < V::size; ++k)
+    if (lanes[k] > result)
+      result = lanes[k];
+  for (; i < samples; ++i)
+  {
+    const T v = src[i] < 0 ? -src[i] : src[i];
+    if (v > result)
+      result = v;
+  }
+  return result;
+}
+
+template <typename T>
+void simd_peak_and_energy (int samples, T const* src, T& peak, T& energy)
+{
+  typedef typename SimdVector<T>::type V;
+  V m = V::set1 (0);
+  V e = V::set1 (0);
+  int i = 0;
+  for (; i + V::size <= samples; i += V::size)
+  {
+    const V x = V::load (src + i);
+    m = vmax (m, vabs (x));
+    e = e + x * x;
+  }
+  T peaks [V::size];
+  T sums [V::size];
+  m.store (peaks);
+  e.store (sums);
+  peak = 0;
+  energy = 0;
+  for (int k = 0; k < V::size; ++k)
+  {
+    if (peaks[k] > peak)
+      peak = peaks[k];
+    energy += sums[k];
+  }
+  for (; i < samples; ++i)
+  {
+    const T v = src[i] < 0 ? -src[i] : src[i];
+    if (v > peak)
+      peak = v;
+    energy += src[i] * src[i];
+  }
+}
+
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+// Fill dest with count normalized frequencies, logarithmically spaced
+// from minFrequency to maxFrequency inclusive. For response plots.
+inline void log_frequencies (int count,
+                             double* dest,
+                             double minFrequency,
+                             double maxFrequency)
+{
+  if (count == 1)
+  {
+    dest[0] = minFrequency;
+    return;
+  }
+
+  const double ratio = log (maxFrequency / minFrequency) / (count - 1);
+  for (int i = 0; i < count; ++i)
+    dest[i] = minFrequency * exp (ratio * i);
+}
+
 //------------------------------------------------------------------------------
 
 // Add src samples to dest, without clip or overflow checking.
@@ -76,6 +291,24 @@ void add (int samples,
   }
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void add (int samples, float* dest, float const* src, int destSkip = 0, int srcSkip = 0)
+{
+  if (srcSkip != 0 || destSkip != 0)
+    add<float, float> (samples, dest, src, destSkip, srcSkip);
+  else
+    detail::simd_add (samples, dest, src);
+}
+
+inline void add (int samples, double* dest, double const* src, int destSkip = 0, int srcSkip = 0)
+{
+  if (srcSkip != 0 || destSkip != 0)
+    add<double, double> (samples, dest, src, destSkip, srcSkip);
+  else
+    detail::simd_add (samples, dest, src);
+}
+#endif
+
 // Multichannel add
 template <typename Td,
           typename Ts>
@@ -178,6 +411,9 @@ void deinterleave (int channels,
 {
   assert (channels > 1);
 
+  if (samples == 0)
+    return;
+
   switch (channels)
   {
   case 2:
@@ -212,6 +448,24 @@ void deinterleave (int channels,
   };
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void deinterleave (int channels, int samples, float* const* dest, float const* src)
+{
+  if (channels == 2)
+    detail::simd_deinterleave2 (samples, dest[0], dest[1], src);
+  else
+    deinterleave<float, float> (channels, samples, dest, src);
+}
+
+inline void deinterleave (int channels, int samples, double* const* dest, double const* src)
+{
+  if (channels == 2)
+    detail::simd_deinterleave2 (samples, dest[0], dest[1], src);
+  else
+    deinterleave<double, double> (channels, samples, dest, src);
+}
+#endif
+
 // Convenience for a stereo pair of channels
 template <typename Td,
           typename Ts>
@@ -246,6 +500,18 @@ void fade (int samples,
   }
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void fade (int samples, float* dest, float start = 0, float end = 1)
+{
+  detail::simd_fade (samples, dest, start, end);
+}
+
+inline void fade (int samples, double* dest, double start = 0, double end = 1)
+{
+  detail::simd_fade (samples, dest, start, end);
+}
+#endif
+
 // Fade dest cannels
 template <typename Td,
           typename Ty>
@@ -280,6 +546,18 @@ void fade (int samples,
   }
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void fade (int samples, float* dest, float const* src, float start = 0, float end = 1)
+{
+  detail::simd_fade (samples, dest, src, start, end);
+}
+
+inline void fade (int samples, double* dest, double const* src, double start = 0, double end = 1)
+{
+  detail::simd_fade (samples, dest, src, start, end);
+}
+#endif
+
 // Fade src channels into dest channels
 template <typename Td,
           typename Ts,
@@ -348,6 +626,24 @@ void interleave (int channels,
   };
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void interleave (int channels, size_t samples, float* dest, float const* const* src)
+{
+  if (channels == 2)
+    detail::simd_interleave2 (int (samples), dest, src[0], src[1]);
+  else
+    interleave<float, float> (channels, samples, dest, src);
+}
+
+inline void interleave (int channels, size_t samples, double* dest, double const* const* src)
+{
+  if (channels == 2)
+    detail::simd_interleave2 (int (samples), dest, src[0], src[1]);
+  else
+    interleave<double, double> (channels, samples, dest, src);
+}
+#endif
+
 //--------------------------------------------------------------------------
 
 // Convenience for a stereo channel pair
@@ -392,6 +688,24 @@ void multiply (int samples,
   }
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void multiply (int samples, float* dest, float factor, int destSkip = 0)
+{
+  if (destSkip != 0)
+    multiply<float, float> (samples, dest, factor, destSkip);
+  else
+    detail::simd_multiply (samples, dest, factor);
+}
+
+inline void multiply (int samples, double* dest, double factor, int destSkip = 0)
+{
+  if (destSkip != 0)
+    multiply<double, double> (samples, dest, factor, destSkip);
+  else
+    detail::simd_multiply (samples, dest, factor);
+}
+#endif
+
 // Multiply a set of channels by a constant.
 template <typename Td,
           typename Ty>
@@ -437,6 +751,24 @@ void reverse (int samples,
   }
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void reverse (int samples, float* dest, float const* src, int destSkip = 0, int srcSkip = 0)
+{
+  if (srcSkip != 0 || destSkip != 0)
+    reverse<float, float> (samples, dest, src, destSkip, srcSkip);
+  else
+    detail::simd_reverse (samples, dest, src);
+}
+
+inline void reverse (int samples, double* dest, double const* src, int destSkip = 0, int srcSkip = 0)
+{
+  if (srcSkip != 0 || destSkip != 0)
+    reverse<double, double> (samples, dest, src, destSkip, srcSkip);
+  else
+    detail::simd_reverse (samples, dest, src);
+}
+#endif
+
 template <typename Td, typename Ts>
 void reverse (int channels, size_t frames, Td* const* dest, const Ts* const* src)
 {
@@ -458,6 +790,90 @@ void to_mono (int samples, Tn* dest, Tn const* left, Tn const* right)
 #endif
 }
 
+#if DSPFILTERS_SIMD_BUFFERS
+inline void to_mono (int samples, float* dest, float const* left, float const* right)
+{
+  detail::simd_to_mono (samples, dest, left, right);
+}
+
+inline void to_mono (int samples, double* dest, double const* left, double const* right)
+{
+  detail::simd_to_mono (samples, dest, left, right);
+}
+#endif
+
+//--------------------------------------------------------------------------
+
+// Largest absolute sample value, zero for an empty buffer.
+template <typename Ty>
+Ty peak (int samples, Ty const* src)
+{
+  Ty result = 0;
+  while (samples-- > 0)
+  {
+    const Ty v = *src < 0 ? -*src : *src;
+    if (v > result)
+      result = v;
+    ++src;
+  }
+  return result;
+}
+
+#if DSPFILTERS_SIMD_BUFFERS
+inline float peak (int samples, float const* src)
+{
+  return detail::simd_peak (samples, src);
+}
+
+inline double peak (int samples, double const* src)
+{
+  return detail::simd_peak (samples, src);
+}
+#endif
+
+// Largest absolute sample value and sum of squares, in a single pass
+// over src. The RMS level is sqrt (energy / samples).
+template <typename Ty>
+void peak_and_energy (int samples, Ty const* src, Ty& peak, Ty& energy)
+{
+  peak = 0;
+  energy = 0;
+  while (samples-- > 0)
+  {
+    const Ty v = *src < 0 ? -*src : *src;
+    if (v > peak)
+      peak = v;
+    energy += v * v;
+    ++src;
+  }
+}
+
+#if DSPFILTERS_SIMD_BUFFERS
+inline void peak_and_energy (int samples, float const* src, float& peak, float& energy)
+{
+  detail::simd_peak_and_energy (samples, src, peak, energy);
+}
+
+inline void peak_and_energy (int samples, double const* src, double& peak, double& energy)
+{
+  detail::simd_peak_and_energy (samples, src, peak, energy);
+}
+#endif
+
+// Largest absolute sample value over a set of channels.
+template <typename Ty>
+Ty peak (int channels, int samples, Ty const* const* src)
+{
+  Ty result = 0;
+  for (int i = channels; --i >= 0;)
+  {
+    const Ty v = peak (samples, src[i]);
+    if (v > result)
+      result = v;
+  }
+  return result;
+}
+
 //--------------------------------------------------------------------------
 
 template <typename T>
@@ -35,6 +35,8 @@ THE SOFTWARE.
 
 #include "DspFilters/Common.h"
 #include "DspFilters/Bessel.h"
+#include "DspFilters/DesignCache.h"
+#include "DspFilters/PrototypeTables.h"
 #include "DspFilters/RootFinder.h"
 
 namespace Dsp {
@@ -69,19 +71,31 @@ AnalogLowPass::AnalogLowPass ()
   setNormal (0, 1);
 }
 
-void AnalogLowPass::design (int numPoles,
+bool AnalogLowPass::design (int numPoles,
                             WorkspaceBase* w)
 {
+  bool converged = true;
+
   if (m_numPoles != numPoles)
   {
     m_numPoles = numPoles;
 
     reset ();
 
+#ifndef DSPFILTERS_NO_PROTOTYPE_TABLES
+    if (loadPrototypeTable (prototypeBessel, numPoles, *this))
+      return true;
+#endif
+
+    DesignCache& cache = DesignCache::getInstance ();
+    const uint64_t key = DesignCache::makePrototypeKey ("Bessel", numPoles);
+    if (cache.findPrototype (key, *this))
+      return true;
+
     RootFinderBase& solver (w->roots);
     for (int i = 0; i < numPoles + 1; ++i)
       solver.coef()[i] = reversebessel (i, numPoles);
-    solver.solve (numPoles);
+    converged = solver.solve (numPoles);
 
     const int pairs = numPoles / 2;
     for (int i = 0; i < pairs; ++i)
@@ -92,7 +106,14 @@ void AnalogLowPass::design (int numPoles,
 
     if (numPoles & 1)
       add (solver.root()[pairs].real(), infinity());
+
+    if (converged)
+      cache.storePrototype (key, *this);
+    else
+      m_numPoles = -1;
   }
+
+  return converged;
 }
 
 //------------------------------------------------------------------------------
@@ -103,10 +124,12 @@ AnalogLowShelf::AnalogLowShelf ()
   setNormal (doublePi, 1);
 }
 
-void AnalogLowShelf::design (int numPoles,
+bool AnalogLowShelf::design (int numPoles,
                              double gainDb,
                              WorkspaceBase* w)
 {
+  bool converged = true;
+
   if (m_numPoles != numPoles ||
       m_gainDb != gainDb)
   {
@@ -120,14 +143,14 @@ void AnalogLowShelf::design (int numPoles,
     RootFinderBase& poles (w->roots);
     for (int i = 0; i < numPoles + 1; ++i)
       poles.coef()[i] = reversebessel (i, numPoles);
-    poles.solve (numPoles);
+    converged = poles.solve (numPoles);
 
     RootFinder<50> zeros;
     for (int i = 0; i < numPoles + 1; ++i)
       zeros.coef()[i] = reversebessel (i, numPoles);
     double a0 = reversebessel (0, numPoles);
     zeros.coef()[0] += G * a0;
-    zeros.solve (numPoles);
+    converged &= zeros.solve (numPoles);
 
     const int pairs = numPoles / 2;
     for (int i = 0; i < pairs; ++i)
@@ -139,46 +162,55 @@ void AnalogLowShelf::design (int numPoles,
 
     if (numPoles & 1)
       add (poles.root()[pairs].real(), zeros.root()[pairs].real());
+
+    if (!converged)
+      m_numPoles = -1;
   }
+
+  return converged;
 }
 
 //------------------------------------------------------------------------------
 
-void LowPassBase::setup (int order,
+bool LowPassBase::setup (int order,
                          double sampleRate,
                          double cutoffFrequency,
                          WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
                     m_digitalProto,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void HighPassBase::setup (int order,
+bool HighPassBase::setup (int order,
                           double sampleRate,
                           double cutoffFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   HighPassTransform (cutoffFrequency / sampleRate,
                      m_digitalProto,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void BandPassBase::setup (int order,
+bool BandPassBase::setup (int order,
                           double sampleRate,
                           double centerFrequency,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   BandPassTransform (centerFrequency / sampleRate,
                      widthFrequency / sampleRate,
@@ -186,15 +218,17 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void BandStopBase::setup (int order,
+bool BandStopBase::setup (int order,
                           double sampleRate,
                           double centerFrequency,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   BandStopTransform (centerFrequency / sampleRate,
                      widthFrequency / sampleRate,
@@ -202,21 +236,25 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void LowShelfBase::setup (int order,
+bool LowShelfBase::setup (int order,
                           double sampleRate,
                           double cutoffFrequency,
                           double gainDb,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, gainDb, w);
+  const bool converged = m_analogProto.design (order, gainDb, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
                     m_digitalProto,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
 }
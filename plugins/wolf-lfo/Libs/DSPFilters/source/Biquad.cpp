@@ -108,6 +108,20 @@ complex_t BiquadBase::response (double normalizedFrequency) const
   return ch / cbot;
 }
 
+void BiquadBase::response (const double* normalizedFrequencies,
+                           complex_t* responses,
+                           int count) const
+{
+  stagesResponse (this, 1, normalizedFrequencies, responses, 0, count);
+}
+
+void BiquadBase::magnitudeResponse (const double* normalizedFrequencies,
+                                    double* magnitudes,
+                                    int count) const
+{
+  stagesResponse (this, 1, normalizedFrequencies, 0, magnitudes, count);
+}
+
 std::vector<PoleZeroPair> BiquadBase::getPoleZeros () const
 {
   std::vector<PoleZeroPair> vpz;
@@ -116,6 +130,34 @@ std::vector<PoleZeroPair> BiquadBase::getPoleZeros () const
   return vpz;
 }
 
+int BiquadBase::getPoleZeros (PoleZeroPair* pairs, int maxPairs) const
+{
+  if (maxPairs < 1)
+    return 0;
+
+  pairs[0] = BiquadPoleState (*this);
+  return 1;
+}
+
+bool BiquadBase::isStable () const
+{
+  // The stable region of (a1, a2) is the triangle
+  // |a2| < 1, |a1| < 1 + a2, which is convex.
+  return std::abs (m_a2) < 1 && std::abs (m_a1) < 1 + m_a2;
+}
+
+void BiquadBase::interpolateStages (const BiquadBase& from,
+                                    const BiquadBase& to,
+                                    double t)
+{
+  m_a0 = from.m_a0 + (to.m_a0 - from.m_a0) * t;
+  m_a1 = from.m_a1 + (to.m_a1 - from.m_a1) * t;
+  m_a2 = from.m_a2 + (to.m_a2 - from.m_a2) * t;
+  m_b0 = from.m_b0 + (to.m_b0 - from.m_b0) * t;
+  m_b1 = from.m_b1 + (to.m_b1 - from.m_b1) * t;
+  m_b2 = from.m_b2 + (to.m_b2 - from.m_b2) * t;
+}
+
 void BiquadBase::setCoefficients (double a0, double a1, double a2,
                                   double b0, double b1, double b2)
 {
@@ -35,6 +35,7 @@ THE SOFTWARE.
 
 #include "DspFilters/Common.h"
 #include "DspFilters/Butterworth.h"
+#include "DspFilters/PrototypeTables.h"
 
 namespace Dsp {
 
@@ -54,6 +55,11 @@ void AnalogLowPass::design (int numPoles)
 
     reset ();
 
+#ifndef DSPFILTERS_NO_PROTOTYPE_TABLES
+    if (loadPrototypeTable (prototypeButterworth, numPoles, *this))
+      return;
+#endif
+
     const double n2 = 2 * numPoles;
     const int pairs = numPoles / 2;
     for (int i = 0; i < pairs; ++i)
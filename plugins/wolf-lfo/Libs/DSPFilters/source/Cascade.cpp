@@ -76,6 +76,22 @@ complex_t Cascade::response (double normalizedFrequency) const
   return ch / cbot;
 }
 
+void Cascade::response (const double* normalizedFrequencies,
+                        complex_t* responses,
+                        int count) const
+{
+  stagesResponse (m_stageArray, m_numStages,
+                  normalizedFrequencies, responses, 0, count);
+}
+
+void Cascade::magnitudeResponse (const double* normalizedFrequencies,
+                                 double* magnitudes,
+                                 int count) const
+{
+  stagesResponse (m_stageArray, m_numStages,
+                  normalizedFrequencies, 0, magnitudes, count);
+}
+
 std::vector<PoleZeroPair> Cascade::getPoleZeros () const
 {
   std::vector<PoleZeroPair> vpz;
@@ -92,6 +108,46 @@ std::vector<PoleZeroPair> Cascade::getPoleZeros () const
   return vpz;
 }
 
+int Cascade::getPoleZeros (PoleZeroPair* pairs, int maxPairs) const
+{
+  const int numPairs = std::min (m_numStages, maxPairs);
+  for (int i = 0; i < numPairs; ++i)
+    pairs[i] = BiquadPoleState (m_stageArray[i]);
+
+  return numPairs;
+}
+
+bool Cascade::isStable () const
+{
+  for (int i = 0; i < m_numStages; ++i)
+    if (!m_stageArray[i].isStable ())
+      return false;
+
+  return true;
+}
+
+void Cascade::copyStages (const Cascade& other)
+{
+  assert (other.m_numStages <= m_maxStages);
+  m_numStages = other.m_numStages;
+
+  for (int i = 0; i < m_numStages; ++i)
+    m_stageArray[i] = other.m_stageArray[i];
+}
+
+void Cascade::interpolateStages (const Cascade& from,
+                                 const Cascade& to,
+                                 double t)
+{
+  assert (from.m_numStages == to.m_numStages);
+  assert (to.m_numStages <= m_maxStages);
+  m_numStages = to.m_numStages;
+
+  for (int i = 0; i < m_numStages; ++i)
+    m_stageArray[i].interpolateStages (from.m_stageArray[i],
+                                       to.m_stageArray[i], t);
+}
+
 void Cascade::applyScale (double scale)
 {
   // For higher order filters it might be helpful
@@ -0,0 +1,170 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Convolution.h"
+
+namespace Dsp {
+
+PartitionedConvolution::PartitionedConvolution ()
+  : m_blockSize (0)
+  , m_numChannels (0)
+  , m_numPartitions (0)
+  , m_maxPartitions (0)
+  , m_position (0)
+  , m_delayPosition (0)
+{
+}
+
+void PartitionedConvolution::setup (int blockSize,
+                                    int maxLength,
+                                    int numChannels)
+{
+  m_blockSize = blockSize;
+  m_numChannels = numChannels;
+  m_maxPartitions = std::max (1, (maxLength + blockSize - 1) / blockSize);
+  m_numPartitions = 0;
+
+  const int fftSize = 2 * blockSize;
+  const int numPairs = (numChannels + 1) / 2;
+
+  m_fft.setup (fftSize);
+  m_input.resize (numChannels * blockSize);
+  m_previous.resize (numChannels * blockSize);
+  m_output.resize (numChannels * blockSize);
+  m_partitions.resize (m_maxPartitions * fftSize);
+  m_delayLine.resize (numPairs * m_maxPartitions * fftSize);
+  m_buffer.resize (fftSize);
+
+  reset ();
+}
+
+void PartitionedConvolution::setImpulse (const double* impulse, int length)
+{
+  const int fftSize = 2 * m_blockSize;
+
+  assert (length <= m_maxPartitions * m_blockSize);
+
+  m_numPartitions = (length + m_blockSize - 1) / m_blockSize;
+
+  for (int p = 0; p < m_numPartitions; ++p)
+  {
+    complex_t* h = &m_partitions[p * fftSize];
+    const int offset = p * m_blockSize;
+    const int n = std::min (m_blockSize, length - offset);
+
+    for (int i = 0; i < fftSize; ++i)
+      h[i] = i < n ? impulse[offset + i] : 0;
+
+    m_fft.forward (h);
+  }
+}
+
+void PartitionedConvolution::reset ()
+{
+  std::fill (m_input.begin (), m_input.end (), 0.);
+  std::fill (m_previous.begin (), m_previous.end (), 0.);
+  std::fill (m_output.begin (), m_output.end (), 0.);
+  std::fill (m_delayLine.begin (), m_delayLine.end (), complex_t (0));
+  m_position = 0;
+  m_delayPosition = 0;
+}
+
+void PartitionedConvolution::processBlock ()
+{
+  const int fftSize = 2 * m_blockSize;
+  complex_t* buffer = &m_buffer[0];
+
+  for (int c = 0; c < m_numChannels; c += 2)
+  {
+    // Second channel of the pair, or silence when the count is odd
+    const bool pair = c + 1 < m_numChannels;
+    double* in0 = &m_input[c * m_blockSize];
+    double* in1 = pair ? in0 + m_blockSize : 0;
+    double* prev0 = &m_previous[c * m_blockSize];
+    double* prev1 = pair ? prev0 + m_blockSize : 0;
+
+    for (int i = 0; i < m_blockSize; ++i)
+    {
+      buffer[i] = complex_t (prev0[i], pair ? prev1[i] : 0);
+      buffer[m_blockSize + i] = complex_t (in0[i], pair ? in1[i] : 0);
+    }
+
+    m_fft.forward (buffer);
+
+    complex_t* delayLine = &m_delayLine[(c / 2) * m_maxPartitions * fftSize];
+    std::copy (buffer, buffer + fftSize, delayLine + m_delayPosition * fftSize);
+
+    std::fill (buffer, buffer + fftSize, complex_t (0));
+
+    for (int p = 0; p < m_numPartitions; ++p)
+    {
+      int slot = m_delayPosition - p;
+      if (slot < 0)
+        slot += m_maxPartitions;
+
+      const complex_t* x = delayLine + slot * fftSize;
+      const complex_t* h = &m_partitions[p * fftSize];
+
+      // Written out, std::complex multiply checks for infinities
+      for (int i = 0; i < fftSize; ++i)
+        buffer[i] += complex_t (x[i].real () * h[i].real () - x[i].imag () * h[i].imag (),
+                                x[i].real () * h[i].imag () + x[i].imag () * h[i].real ());
+    }
+
+    m_fft.inverse (buffer);
+
+    // The first half is wrapped around, only the second half is valid
+    double* out0 = &m_output[c * m_blockSize];
+    for (int i = 0; i < m_blockSize; ++i)
+      out0[i] = buffer[m_blockSize + i].real ();
+
+    if (pair)
+    {
+      double* out1 = out0 + m_blockSize;
+      for (int i = 0; i < m_blockSize; ++i)
+        out1[i] = buffer[m_blockSize + i].imag ();
+    }
+
+    std::copy (in0, in0 + m_blockSize, prev0);
+    if (pair)
+      std::copy (in1, in1 + m_blockSize, prev1);
+  }
+
+  if (++m_delayPosition == m_maxPartitions)
+    m_delayPosition = 0;
+}
+
+}
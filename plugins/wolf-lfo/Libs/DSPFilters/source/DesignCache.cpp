@@ -0,0 +1,307 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "DspFilters/Common.h"
+#include "DspFilters/DesignCache.h"
+
+namespace Dsp {
+
+namespace {
+
+const uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+const uint64_t fnvPrime = 1099511628211ULL;
+
+uint64_t hashBytes (uint64_t hash, const void* data, size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*> (data);
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= fnvPrime;
+  }
+
+  return hash;
+}
+
+uint64_t nonZero (uint64_t key)
+{
+  return key != 0 ? key : 1;
+}
+
+}
+
+DesignCache& DesignCache::getInstance ()
+{
+  static DesignCache instance;
+  return instance;
+}
+
+DesignCache::DesignCache ()
+  : m_clock (0)
+{
+  for (int i = 0; i < prototypeEntries; ++i)
+  {
+    m_prototypes.entries[i].sequence.store (0);
+    m_prototypes.entries[i].lastUsed.store (0);
+    m_prototypes.entries[i].key.store (0);
+    m_prototypes.entries[i].numValues.store (0);
+  }
+
+  for (int i = 0; i < stagesEntries; ++i)
+  {
+    m_stages.entries[i].sequence.store (0);
+    m_stages.entries[i].lastUsed.store (0);
+    m_stages.entries[i].key.store (0);
+    m_stages.entries[i].numValues.store (0);
+  }
+}
+
+uint64_t DesignCache::makePrototypeKey (const char* family, int numPoles)
+{
+  uint64_t hash = hashBytes (fnvOffsetBasis, family, strlen (family));
+  hash = hashBytes (hash, &numPoles, sizeof (numPoles));
+  return nonZero (hash);
+}
+
+uint64_t DesignCache::hashName (const std::string& name)
+{
+  return hashBytes (fnvOffsetBasis, name.data (), name.size ());
+}
+
+uint64_t DesignCache::makeDesignKey (uint64_t nameHash,
+                                     const Params& parameters,
+                                     int numParams)
+{
+  uint64_t hash = nameHash;
+
+  // Parameters are quantized to about 1/20000 of their value, which is
+  // well below what automation can resolve, so sweeps hit the cache.
+  for (int i = 0; i < numParams; ++i)
+  {
+    const float value = static_cast<float> (parameters[i]);
+    uint32_t bits;
+    memcpy (&bits, &value, sizeof (bits));
+    bits = (bits + 0x40) & ~0x7fu;
+    hash = hashBytes (hash, &bits, sizeof (bits));
+  }
+
+  return nonZero (hash);
+}
+
+template <int NumValues, int NumEntries>
+bool DesignCache::find (Table<NumValues, NumEntries>& table,
+                        uint64_t key, double* values)
+{
+  const int first = static_cast<int> (key % NumEntries);
+
+  for (int probe = 0; probe < probeLength; ++probe)
+  {
+    Entry<NumValues>& entry = table.entries[(first + probe) % NumEntries];
+
+    const uint32_t sequence = entry.sequence.load (std::memory_order_acquire);
+    if ((sequence & 1) != 0 || entry.key.load (std::memory_order_relaxed) != key)
+      continue;
+
+    const int numValues = std::min (entry.numValues.load (std::memory_order_relaxed),
+                                    int (NumValues));
+    for (int i = 0; i < numValues; ++i)
+      values[i] = entry.values[i].load (std::memory_order_relaxed);
+
+    std::atomic_thread_fence (std::memory_order_acquire);
+    if (entry.sequence.load (std::memory_order_relaxed) != sequence)
+      return false; // being replaced
+
+    entry.lastUsed.store (m_clock.fetch_add (1, std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    return true;
+  }
+
+  return false;
+}
+
+template <int NumValues, int NumEntries>
+void DesignCache::store (Table<NumValues, NumEntries>& table,
+                         uint64_t key, const double* values, int numValues)
+{
+  // never wait, the caller may be the audio thread
+  std::unique_lock<std::mutex> lock (m_writeMutex, std::try_to_lock);
+  if (!lock.owns_lock ())
+    return;
+
+  // pick the entry with this key, else an empty one,
+  // else the least recently used one
+  const int first = static_cast<int> (key % NumEntries);
+  const uint32_t now = m_clock.load (std::memory_order_relaxed);
+  Entry<NumValues>* victim = 0;
+  uint32_t victimAge = 0;
+
+  for (int probe = 0; probe < probeLength; ++probe)
+  {
+    Entry<NumValues>& entry = table.entries[(first + probe) % NumEntries];
+    const uint64_t entryKey = entry.key.load (std::memory_order_relaxed);
+
+    if (entryKey == key || entryKey == 0)
+    {
+      victim = &entry;
+      break;
+    }
+
+    const uint32_t age = now - entry.lastUsed.load (std::memory_order_relaxed);
+    if (victim == 0 || age > victimAge)
+    {
+      victim = &entry;
+      victimAge = age;
+    }
+  }
+
+  const uint32_t sequence = victim->sequence.load (std::memory_order_relaxed);
+  victim->sequence.store (sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence (std::memory_order_release);
+
+  victim->key.store (key, std::memory_order_relaxed);
+  victim->numValues.store (numValues, std::memory_order_relaxed);
+  for (int i = 0; i < numValues; ++i)
+    victim->values[i].store (values[i], std::memory_order_relaxed);
+  victim->lastUsed.store (now, std::memory_order_relaxed);
+
+  victim->sequence.store (sequence + 2, std::memory_order_release);
+}
+
+bool DesignCache::findPrototype (uint64_t key, LayoutBase& layout)
+{
+  double values[prototypeValues];
+  if (!find (m_prototypes, key, values))
+    return false;
+
+  const int numPoles = static_cast<int> (values[0]);
+  if (numPoles > layout.getMaxPoles ())
+    return false;
+
+  layout.m_numPoles = numPoles;
+  layout.setNormal (values[1], values[2]);
+
+  const double* v = values + 3;
+  for (int i = 0; i < (numPoles + 1) / 2; ++i, v += 8)
+  {
+    PoleZeroPair& pair = layout.m_pair[i];
+    pair.poles.first = complex_t (v[0], v[1]);
+    pair.poles.second = complex_t (v[2], v[3]);
+    pair.zeros.first = complex_t (v[4], v[5]);
+    pair.zeros.second = complex_t (v[6], v[7]);
+  }
+
+  return true;
+}
+
+void DesignCache::storePrototype (uint64_t key, const LayoutBase& layout)
+{
+  const int numPoles = layout.getNumPoles ();
+  if (numPoles > maxPrototypePoles)
+    return;
+
+  double values[prototypeValues];
+  values[0] = numPoles;
+  values[1] = layout.getNormalW ();
+  values[2] = layout.getNormalGain ();
+
+  double* v = values + 3;
+  for (int i = 0; i < (numPoles + 1) / 2; ++i, v += 8)
+  {
+    const PoleZeroPair& pair = layout.m_pair[i];
+    v[0] = pair.poles.first.real ();
+    v[1] = pair.poles.first.imag ();
+    v[2] = pair.poles.second.real ();
+    v[3] = pair.poles.second.imag ();
+    v[4] = pair.zeros.first.real ();
+    v[5] = pair.zeros.first.imag ();
+    v[6] = pair.zeros.second.real ();
+    v[7] = pair.zeros.second.imag ();
+  }
+
+  store (m_prototypes, key, values, static_cast<int> (v - values));
+}
+
+bool DesignCache::findStages (uint64_t key, Cascade& cascade)
+{
+  double values[stagesValues];
+  if (!find (m_stages, key, values))
+    return false;
+
+  const int numStages = static_cast<int> (values[0]);
+  if (numStages > cascade.m_maxStages)
+    return false;
+
+  cascade.m_numStages = numStages;
+
+  const double* v = values + 1;
+  for (int i = 0; i < numStages; ++i, v += 6)
+  {
+    Cascade::Stage& stage = cascade.m_stageArray[i];
+    stage.m_a0 = v[0];
+    stage.m_a1 = v[1];
+    stage.m_a2 = v[2];
+    stage.m_b0 = v[3];
+    stage.m_b1 = v[4];
+    stage.m_b2 = v[5];
+  }
+
+  return true;
+}
+
+void DesignCache::storeStages (uint64_t key, const Cascade& cascade)
+{
+  const int numStages = cascade.m_numStages;
+  if (numStages > maxStages)
+    return;
+
+  double values[stagesValues];
+  values[0] = numStages;
+
+  double* v = values + 1;
+  for (int i = 0; i < numStages; ++i, v += 6)
+  {
+    const Cascade::Stage& stage = cascade.m_stageArray[i];
+    v[0] = stage.m_a0;
+    v[1] = stage.m_a1;
+    v[2] = stage.m_a2;
+    v[3] = stage.m_b0;
+    v[4] = stage.m_b1;
+    v[5] = stage.m_b2;
+  }
+
+  store (m_stages, key, values, static_cast<int> (v - values));
+}
+
+}
@@ -35,6 +35,7 @@ THE SOFTWARE.
 
 #include "DspFilters/Common.h"
 #include "DspFilters/Elliptic.h"
+#include "DspFilters/PrototypeTables.h"
 
 namespace Dsp {
 
@@ -86,6 +87,15 @@ void AnalogLowPass::design (int numPoles,
 
     reset ();
 
+#ifndef DSPFILTERS_NO_PROTOTYPE_TABLES
+    // only even orders are tabulated
+    if (loadEllipticPrototypeTable (numPoles, rippleDb, rolloff, *this))
+    {
+      setNormal (0, pow (10., -rippleDb / 20.0));
+      return;
+    }
+#endif
+
     // calculate
     //const double ep = rippleDb; // passband ripple
 
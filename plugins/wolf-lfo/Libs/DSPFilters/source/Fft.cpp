@@ -0,0 +1,122 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "DspFilters/Common.h"
+#include "DspFilters/Fft.h"
+#include "DspFilters/MathSupplement.h"
+
+namespace Dsp {
+
+Fft::Fft ()
+  : m_size (0)
+{
+}
+
+void Fft::setup (int size)
+{
+  assert (size > 0 && (size & (size - 1)) == 0);
+
+  m_size = size;
+
+  int bits = 0;
+  while ((1 << bits) < size)
+    ++bits;
+
+  m_bitReverse.resize (size);
+  for (int i = 0; i < size; ++i)
+  {
+    int r = 0;
+    for (int b = 0; b < bits; ++b)
+      if (i & (1 << b))
+        r |= 1 << (bits - 1 - b);
+    m_bitReverse[i] = r;
+  }
+
+  m_twiddles.resize (std::max (1, size / 2));
+  for (int i = 0; i < size / 2; ++i)
+    m_twiddles[i] = std::polar (1., -2 * doublePi * i / size);
+}
+
+void Fft::forward (complex_t* data) const
+{
+  transform (data, false);
+}
+
+void Fft::inverse (complex_t* data) const
+{
+  transform (data, true);
+
+  const double scale = 1. / m_size;
+  for (int i = 0; i < m_size; ++i)
+    data[i] *= scale;
+}
+
+void Fft::transform (complex_t* data, bool inverse) const
+{
+  const int n = m_size;
+
+  for (int i = 0; i < n; ++i)
+  {
+    const int j = m_bitReverse[i];
+    if (j > i)
+      std::swap (data[i], data[j]);
+  }
+
+  for (int half = 1; half < n; half *= 2)
+  {
+    const int step = n / (2 * half);
+
+    for (int start = 0; start < n; start += 2 * half)
+    {
+      complex_t* a = data + start;
+      complex_t* b = a + half;
+
+      for (int k = 0; k < half; ++k)
+      {
+        const complex_t& tw = m_twiddles[k * step];
+        const double wr = tw.real ();
+        const double wi = inverse ? -tw.imag () : tw.imag ();
+        const double br = b[k].real () * wr - b[k].imag () * wi;
+        const double bi = b[k].real () * wi + b[k].imag () * wr;
+        const double ar = a[k].real ();
+        const double ai = a[k].imag ();
+        a[k] = complex_t (ar + br, ai + bi);
+        b[k] = complex_t (ar - br, ai - bi);
+      }
+    }
+  }
+}
+
+}
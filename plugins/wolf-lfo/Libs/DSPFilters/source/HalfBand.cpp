@@ -0,0 +1,325 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "DspFilters/Common.h"
+#include "DspFilters/HalfBand.h"
+#include "DspFilters/MathSupplement.h"
+
+namespace Dsp {
+
+namespace {
+
+// q^n for a small integer power, without the cost of pow()
+double powInt (double q, int n)
+{
+  double result = 1;
+  for (int i = 0; i < n; ++i)
+    result *= q;
+  return result;
+}
+
+void transitionParams (double transition, double& k, double& q)
+{
+  k = tan ((1 - transition * 2) * doublePi / 4);
+  k *= k;
+
+  const double kksqrt = pow (1 - k * k, 0.25);
+  const double e = 0.5 * (1 - kksqrt) / (1 + kksqrt);
+  const double e2 = e * e;
+  const double e4 = e2 * e2;
+
+  q = e * (1 + e4 * (2 + e4 * (15 + 150 * e4)));
+}
+
+int designOrder (double attenuation, double q)
+{
+  const double attn = pow (10., -attenuation / 10);
+  const double a = attn / (1 - attn);
+
+  int order = int (ceil (log (a * a / 16) / log (q)));
+  if ((order & 1) == 0)
+    ++order;
+  if (order == 1)
+    order = 3;
+
+  return order;
+}
+
+double designCoefficient (int index, double k, double q, int order)
+{
+  const int c = index + 1;
+
+  // Truncated series, the terms decay as powers of q
+  double num = 0;
+  double sign = 1;
+  for (int i = 0; i < 32; ++i)
+  {
+    const double term = powInt (q, i * (i + 1)) * sin ((i * 2 + 1) * c * doublePi / order) * sign;
+    num += term;
+    sign = -sign;
+    if (fabs (term) < 1e-100)
+      break;
+  }
+
+  double den = 0;
+  sign = -1;
+  for (int i = 1; i < 32; ++i)
+  {
+    const double term = powInt (q, i * i) * cos (i * 2 * c * doublePi / order) * sign;
+    den += term;
+    sign = -sign;
+    if (fabs (term) < 1e-100)
+      break;
+  }
+
+  const double ww = num * pow (q, 0.25) / (den + 0.5);
+  const double wwsq = ww * ww;
+  const double x = sqrt ((1 - wwsq * k) * (1 - wwsq / k)) / (1 + wwsq);
+
+  return (1 - x) / (1 + x);
+}
+
+}
+
+//------------------------------------------------------------------------------
+
+HalfBandStage::HalfBandStage ()
+  : m_numCoefficients (0)
+  , m_numSections (0)
+  , m_lastCoefficient (0)
+{
+  reset ();
+}
+
+void HalfBandStage::setup (double attenuation, double transition)
+{
+  double k, q;
+  transitionParams (transition, k, q);
+
+  const int order = designOrder (attenuation, q);
+  m_numCoefficients = std::min (int (maxCoefficients), (order - 1) / 2);
+  m_numSections = m_numCoefficients / 2;
+
+  double coefficients[maxCoefficients];
+  for (int i = 0; i < m_numCoefficients; ++i)
+    coefficients[i] = designCoefficient (i, k, q, order);
+
+  for (int i = 0; i < m_numSections; ++i)
+    m_coefficients[i] = double2::set (coefficients[2 * i], coefficients[2 * i + 1]);
+
+  if (m_numCoefficients & 1)
+    m_lastCoefficient = coefficients[m_numCoefficients - 1];
+}
+
+double HalfBandStage::getGroupDelay () const
+{
+  // Each section delays DC by (1 - a) / (1 + a) low rate samples
+  double delay[2] = { 0, 0 };
+
+  for (int i = 0; i < m_numSections; ++i)
+  {
+    double a[2];
+    m_coefficients[i].store (a);
+    delay[0] += (1 - a[0]) / (1 + a[0]);
+    delay[1] += (1 - a[1]) / (1 + a[1]);
+  }
+
+  if (m_numCoefficients & 1)
+    delay[0] += (1 - m_lastCoefficient) / (1 + m_lastCoefficient);
+
+  return delay[0] + delay[1] + 0.5;
+}
+
+void HalfBandStage::reset ()
+{
+  for (int i = 0; i < maxCoefficients / 2; ++i)
+  {
+    m_x[i] = double2::zero ();
+    m_y[i] = double2::zero ();
+  }
+
+  m_lastX = 0;
+  m_lastY = 0;
+}
+
+void HalfBandStage::upsample (int numSamples, double* dest, const double* src)
+{
+  for (int i = 0; i < numSamples; ++i)
+  {
+    double2 v = double2::set1 (src[i]);
+
+    for (int s = 0; s < m_numSections; ++s)
+    {
+      const double2 y = m_coefficients[s] * (v - m_y[s]) + m_x[s];
+      m_x[s] = v;
+      m_y[s] = y;
+      v = y;
+    }
+
+    v.store (dest + 2 * i);
+
+    if (m_numCoefficients & 1)
+      dest[2 * i] = processLastSection (dest[2 * i]);
+  }
+}
+
+void HalfBandStage::downsample (int numSamples, double* dest, const double* src)
+{
+  for (int i = 0; i < numSamples; ++i)
+  {
+    double2 v = double2::set (src[2 * i + 1], src[2 * i]);
+
+    for (int s = 0; s < m_numSections; ++s)
+    {
+      const double2 y = m_coefficients[s] * (v - m_y[s]) + m_x[s];
+      m_x[s] = v;
+      m_y[s] = y;
+      v = y;
+    }
+
+    double out[2];
+    v.store (out);
+
+    if (m_numCoefficients & 1)
+      out[0] = processLastSection (out[0]);
+
+    dest[i] = 0.5 * (out[0] + out[1]);
+  }
+}
+
+//------------------------------------------------------------------------------
+
+HalfBandOversampler::HalfBandOversampler ()
+  : m_numStages (0)
+  , m_numChannels (0)
+  , m_maxBlockSize (0)
+  , m_bufferSize (0)
+{
+}
+
+void HalfBandOversampler::setup (int factor,
+                                 Quality quality,
+                                 int numChannels,
+                                 int maxBlockSize)
+{
+  static const double attenuations[] = { 70, 100, 140 };
+  static const double transitions[] = { 0.1, 0.05, 0.02 };
+
+  m_numStages = 0;
+  while ((2 << m_numStages) <= factor && m_numStages < maxStages)
+    ++m_numStages;
+
+  m_numChannels = numChannels;
+  m_maxBlockSize = maxBlockSize;
+  m_bufferSize = maxBlockSize << m_numStages;
+
+  m_up.resize (numChannels * maxStages);
+  m_down.resize (numChannels * maxStages);
+  m_buffers.resize (2 * numChannels * m_bufferSize);
+  m_result.resize (numChannels);
+
+  for (int s = 0; s < m_numStages; ++s)
+  {
+    // After the first stage, the content only reaches a quarter of
+    // the rate this stage starts from
+    const double transition = s == 0
+      ? transitions[quality]
+      : 0.5 - 1. / (2 << s);
+
+    for (int c = 0; c < numChannels; ++c)
+    {
+      m_up[c * maxStages + s].setup (attenuations[quality], transition);
+      m_down[c * maxStages + s].setup (attenuations[quality], transition);
+    }
+  }
+
+  reset ();
+}
+
+double HalfBandOversampler::getLatency () const
+{
+  double latency = 0;
+
+  // The downsampler feeds the odd sample to the first branch, which
+  // takes one high rate sample off its delay.
+  if (m_numChannels > 0)
+    for (int s = 0; s < m_numStages; ++s)
+      latency += (2 * m_up[s].getGroupDelay () - 1) / (2 << s);
+
+  return latency;
+}
+
+void HalfBandOversampler::reset ()
+{
+  for (size_t i = 0; i < m_up.size (); ++i)
+  {
+    m_up[i].reset ();
+    m_down[i].reset ();
+  }
+}
+
+// Ping-pongs between the two buffers of the channel, returns the one
+// holding the result
+int HalfBandOversampler::upsampleChannel (int channel, int numSamples)
+{
+  int which = 1;
+
+  for (int s = 0; s < m_numStages; ++s)
+  {
+    m_up[channel * maxStages + s].upsample (numSamples << s,
+                                            getBuffer (channel, 1 - which),
+                                            getBuffer (channel, which));
+    which = 1 - which;
+  }
+
+  return which;
+}
+
+const double* HalfBandOversampler::downsampleChannel (int channel, int numSamples)
+{
+  double* src = m_result[channel];
+  double* other = src == getBuffer (channel, 0) ? getBuffer (channel, 1)
+                                                : getBuffer (channel, 0);
+
+  for (int s = m_numStages; --s >= 0;)
+  {
+    m_down[channel * maxStages + s].downsample (numSamples << s, other, src);
+    std::swap (src, other);
+  }
+
+  return src;
+}
+
+}
@@ -34,7 +34,9 @@ THE SOFTWARE.
 *******************************************************************************/
 
 #include "DspFilters/Common.h"
+#include "DspFilters/DesignCache.h"
 #include "DspFilters/Legendre.h"
+#include "DspFilters/PrototypeTables.h"
 #include "DspFilters/RootFinder.h"
 
 #include <sstream>
@@ -234,15 +236,27 @@ AnalogLowPass::AnalogLowPass ()
   setNormal (0, 1);
 }
 
-void AnalogLowPass::design (int numPoles,
+bool AnalogLowPass::design (int numPoles,
                             WorkspaceBase* w)
 {
+  bool converged = true;
+
   if (m_numPoles != numPoles)
   {
     m_numPoles = numPoles;
 
     reset ();
 
+#ifndef DSPFILTERS_NO_PROTOTYPE_TABLES
+    if (loadPrototypeTable (prototypeLegendre, numPoles, *this))
+      return true;
+#endif
+
+    DesignCache& cache = DesignCache::getInstance ();
+    const uint64_t key = DesignCache::makePrototypeKey ("Legendre", numPoles);
+    if (cache.findPrototype (key, *this))
+      return true;
+
     PolynomialFinderBase& poly (w->poly);
     RootFinderBase& poles (w->roots);
 
@@ -256,7 +270,7 @@ void AnalogLowPass::design (int numPoles,
       poles.coef()[2*i] = poly.coef()[i] * ((i & 1) ? -1 : 1);
       poles.coef()[2*i+1] = 0;
     }
-    poles.solve (degree);
+    converged = poles.solve (degree);
 
     int j = 0;
     for (int i = 0; i < degree; ++i)
@@ -274,46 +288,57 @@ void AnalogLowPass::design (int numPoles,
 
     if (numPoles & 1)
       add (poles.root()[pairs].real(), infinity());
+
+    if (converged)
+      cache.storePrototype (key, *this);
+    else
+      m_numPoles = -1;
   }
+
+  return converged;
 }
 
 //------------------------------------------------------------------------------
 
-void LowPassBase::setup (int order,
+bool LowPassBase::setup (int order,
                          double sampleRate,
                          double cutoffFrequency,
                          WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
                     m_digitalProto,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void HighPassBase::setup (int order,
+bool HighPassBase::setup (int order,
                           double sampleRate,
                           double cutoffFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   HighPassTransform (cutoffFrequency / sampleRate,
                      m_digitalProto,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void BandPassBase::setup (int order,
+bool BandPassBase::setup (int order,
                           double sampleRate,
                           double centerFrequency,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   BandPassTransform (centerFrequency / sampleRate,
                      widthFrequency / sampleRate,
@@ -321,15 +346,17 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
-void BandStopBase::setup (int order,
+bool BandStopBase::setup (int order,
                           double sampleRate,
                           double centerFrequency,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
-  m_analogProto.design (order, w);
+  const bool converged = m_analogProto.design (order, w);
 
   BandStopTransform (centerFrequency / sampleRate,
                      widthFrequency / sampleRate,
@@ -337,6 +364,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  return converged;
 }
 
 }
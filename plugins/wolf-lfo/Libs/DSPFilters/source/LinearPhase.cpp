@@ -0,0 +1,119 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "DspFilters/Common.h"
+#include "DspFilters/LinearPhase.h"
+#include "DspFilters/MathSupplement.h"
+
+namespace Dsp {
+
+LinearPhaseKernel::LinearPhaseKernel ()
+  : m_length (0)
+{
+}
+
+void LinearPhaseKernel::setup (int length)
+{
+  m_length = length | 1;
+
+  // Sampling the response well past the kernel length keeps the time
+  // aliasing of the inverse FFT out of the window.
+  int size = 1;
+  while (size < 4 * m_length)
+    size *= 2;
+
+  m_fft.setup (size);
+  m_buffer.resize (size);
+
+  m_frequencies.resize (size / 2 + 1);
+  m_magnitudes.resize (size / 2 + 1);
+  for (int i = 0; i <= size / 2; ++i)
+  {
+    m_frequencies[i] = double (i) / size;
+    m_magnitudes[i] = 1;
+  }
+
+  m_window.resize (m_length);
+  m_taps.resize (m_length);
+  for (int i = 0; i < m_length; ++i)
+  {
+    const double x = m_length > 1 ? double (i) / (m_length - 1) : 0.5;
+    m_window[i] = 0.42 - 0.5 * cos (2 * doublePi * x)
+                       + 0.08 * cos (4 * doublePi * x);
+  }
+
+  design ();
+}
+
+void LinearPhaseKernel::design ()
+{
+  const int size = m_fft.getSize ();
+  const int half = size / 2;
+
+  // Real and even spectrum, so the impulse is real and even too
+  m_buffer[0] = m_magnitudes[0];
+  m_buffer[half] = m_magnitudes[half];
+  for (int i = 1; i < half; ++i)
+  {
+    m_buffer[i] = m_magnitudes[i];
+    m_buffer[size - i] = m_magnitudes[i];
+  }
+
+  m_fft.inverse (&m_buffer[0]);
+
+  const int delay = getDelay ();
+  for (int i = 0; i < m_length; ++i)
+  {
+    int index = i - delay;
+    if (index < 0)
+      index += size;
+    m_taps[i] = m_buffer[index].real () * m_window[i];
+  }
+}
+
+complex_t LinearPhaseKernel::response (double normalizedFrequency) const
+{
+  // Symmetric taps: the sum folds into a real amplitude around the center
+  const double w = 2 * doublePi * normalizedFrequency;
+  const int delay = getDelay ();
+
+  double amplitude = m_taps[delay];
+  for (int i = 1; i <= delay; ++i)
+    amplitude += 2 * m_taps[delay - i] * cos (w * i);
+
+  return std::polar (1., -w * delay) * amplitude;
+}
+
+}
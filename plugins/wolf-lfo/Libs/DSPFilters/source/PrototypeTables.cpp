@@ -0,0 +1,670 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+// Generated by Tools/GeneratePrototypeTables.cpp, do not edit.
+
+#include "DspFilters/Common.h"
+#include "DspFilters/PrototypeTables.h"
+
+namespace Dsp {
+
+namespace {
+
+// First pole of each conjugate pair, real and imaginary parts.
+// All zeros are at infinity.
+
+const double butterworth2[] =
+{
+  -0.70710678118654746, 0.70710678118654757,
+};
+
+const double butterworth4[] =
+{
+  -0.38268343236508973, 0.92387953251128674,
+  -0.92387953251128674, 0.38268343236508989,
+};
+
+const double butterworth8[] =
+{
+  -0.19509032201612819, 0.98078528040323043,
+  -0.55557023301960196, 0.83146961230254546,
+  -0.83146961230254535, 0.55557023301960218,
+  -0.98078528040323043, 0.19509032201612861,
+};
+
+const double bessel2[] =
+{
+  -1.5, 0.8660254037844386,
+};
+
+const double bessel4[] =
+{
+  -2.1037893971796278, 2.6574180418567539,
+  -2.8962106028203745, 0.86723412893449903,
+};
+
+const double bessel8[] =
+{
+  -2.8389839488976358, 6.3539112986048742,
+  -4.368289217202352, 4.4144425004715426,
+  -5.2048407906370047, 2.6161751526426849,
+  -5.5878860432629462, 0.86761444535220844,
+};
+
+const double legendre2[] =
+{
+  -0.70710678118654757, 0.70710678118654746,
+};
+
+const double legendre4[] =
+{
+  -0.23168872267885146, 0.94551066390267346,
+  -0.54974342384548136, 0.35857181622501039,
+};
+
+const double legendre8[] =
+{
+  -0.068942157619261896, 0.98797096806029894,
+  -0.19427588132916124, 0.82476672454114264,
+  -0.30028400490128015, 0.54104224539113266,
+  -0.36717631012214225, 0.18087919953768961,
+};
+
+// Elliptic prototypes for each ripple in ellipticRipples and each whole
+// rolloff from ellipticRolloffMin to ellipticRolloffMax. Every entry
+// has the first pole of each conjugate pair, real and imaginary parts,
+// and the imaginary part of its zero.
+
+const double ellipticRipples[] = { 0.01, 0.1, 0.5, 1, 3 };
+const int ellipticRolloffMin = -4;
+const int ellipticRolloffMax = 4;
+
+const double elliptic2[] =
+{
+  // 0.01 dB, rolloff -4
+  -0.018740041296770395, 1.1558313779415941, 1.15718861771994,
+  // 0.01 dB, rolloff -3
+  -0.041126345724865766, 1.2880507372923518, 1.292005805529685,
+  // 0.01 dB, rolloff -2
+  -0.11050469718255081, 1.5621829185517375, 1.5793426311102621,
+  // 0.01 dB, rolloff -1
+  -0.39160207700408978, 2.1196559134136477, 2.2511677606166764,
+  // 0.01 dB, rolloff 0
+  -1.321135082181955, 2.668859716331816, 3.9506715116170765,
+  // 0.01 dB, rolloff 1
+  -2.0480889597950815, 2.4886671538223553, 8.4555590412443706,
+  // 0.01 dB, rolloff 2
+  -2.1999186266693731, 2.3654512321854484, 20.623235755005993,
+  // 0.01 dB, rolloff 3
+  -2.2237185863060978, 2.341513110103604, 53.658070565296207,
+  // 0.01 dB, rolloff 4
+  -2.2271993772301184, 2.3378837286306036, 143.4386642417268,
+  // 0.1 dB, rolloff -4
+  -0.056841554929233297, 1.1441168426175845, 1.15718861771994,
+  // 0.1 dB, rolloff -3
+  -0.12048165894246048, 1.2553221991267136, 1.292005805529685,
+  // 0.1 dB, rolloff -2
+  -0.28833573034491861, 1.4394896754283224, 1.5793426311102621,
+  // 0.1 dB, rolloff -1
+  -0.67084985701788502, 1.5930284913542285, 2.2511677606166764,
+  // 0.1 dB, rolloff 0
+  -1.037216456627716, 1.5066963127480699, 3.9506715116170765,
+  // 0.1 dB, rolloff 1
+  -1.1574675217882717, 1.412125331392581, 8.4555590412443706,
+  // 0.1 dB, rolloff 2
+  -1.181521780512246, 1.3863063301862615, 20.623235755005993,
+  // 0.1 dB, rolloff 3
+  -1.1854946915332032, 1.381742697742864, 53.658070565296207,
+  // 0.1 dB, rolloff 4
+  -1.1860825764824063, 1.3810596278699154, 143.4386642417268,
+  // 0.5 dB, rolloff -4
+  -0.10721723842476741, 1.1009921324174521, 1.15718861771994,
+  // 0.5 dB, rolloff -3
+  -0.20310272558511455, 1.1524420933133572, 1.292005805529685,
+  // 0.5 dB, rolloff -2
+  -0.37403276628684445, 1.1835092148338864, 1.5793426311102621,
+  // 0.5 dB, rolloff -1
+  -0.5687361670090918, 1.1321396888087245, 2.2511677606166764,
+  // 0.5 dB, rolloff 0
+  -0.67401335769054349, 1.0512395813173396, 3.9506715116170765,
+  // 0.5 dB, rolloff 1
+  -0.70505443200463047, 1.0146273492640303, 8.4555590412443706,
+  // 0.5 dB, rolloff 2
+  -0.71153607715066547, 1.005830479616117, 20.623235755005993,
+  // 0.5 dB, rolloff 3
+  -0.71262444761539556, 1.0043068184984754, 53.658070565296207,
+  // 0.5 dB, rolloff 4
+  -0.71278598986231423, 1.0040794805214872, 143.4386642417268,
+  // 1 dB, rolloff -4
+  -0.12587779112927944, 1.0614763806245338, 1.15718861771994,
+  // 1 dB, rolloff -3
+  -0.21874160486563057, 1.0756986457321098, 1.292005805529685,
+  // 1 dB, rolloff -2
+  -0.35106770707575996, 1.0553129323715236, 1.5793426311102621,
+  // 1 dB, rolloff -1
+  -0.46983877880016339, 0.98746607483234039, 2.2511677606166764,
+  // 1 dB, rolloff 0
+  -0.52748404637504331, 0.92647586249359848, 3.9506715116170765,
+  // 1 dB, rolloff 1
+  -0.5445414811971282, 0.90202168599010579, 8.4555590412443706,
+  // 1 dB, rolloff 2
+  -0.54815313698441859, 0.89628853661377683, 20.623235755005993,
+  // 1 dB, rolloff 3
+  -0.54876201952148007, 0.89529995252366212, 53.658070565296207,
+  // 1 dB, rolloff 4
+  -0.54885245739545752, 0.89515255704730279, 143.4386642417268,
+  // 3 dB, rolloff -4
+  -0.12188385771183115, 0.97728999425300722, 1.15718861771994,
+  // 3 dB, rolloff -3
+  -0.18280270632596124, 0.94631983614614557, 1.292005805529685,
+  // 3 dB, rolloff -2
+  -0.2473428853245408, 0.893061123136903, 1.5793426311102621,
+  // 3 dB, rolloff -1
+  -0.2935454403542429, 0.83341893902652786, 2.2511677606166764,
+  // 3 dB, rolloff 0
+  -0.31451371453759902, 0.7950199080190814, 3.9506715116170765,
+  // 3 dB, rolloff 1
+  -0.32082456129848191, 0.78101690915535638, 8.4555590412443706,
+  // 3 dB, rolloff 2
+  -0.32218065506591359, 0.7778046986323105, 20.623235755005993,
+  // 3 dB, rolloff 3
+  -0.32241016530657812, 0.77725312369608901, 53.658070565296207,
+  // 3 dB, rolloff 4
+  -0.32244427776005691, 0.77717094158411038, 143.4386642417268,
+};
+
+const double elliptic4[] =
+{
+  // 0.01 dB, rolloff -4
+  -0.01164112463504036, 1.0501095318993849, 1.7081435549827368,
+  -0.3162979790583984, 1.6083510003277846, 1.0526647130865328,
+  // 0.01 dB, rolloff -3
+  -0.038488423556184141, 1.1102731228557163, 2.0456614725101949,
+  -0.672934613345614, 1.6322987871451722, 1.125963310741581,
+  // 0.01 dB, rolloff -2
+  -0.11771297005950071, 1.2068612214232766, 2.6708394881500817,
+  -1.04715181833071, 1.2542098253655412, 1.3101598792159537,
+  // 0.01 dB, rolloff -1
+  -0.24867896445261126, 1.2953813344357628, 4.0024211001801548,
+  -1.080728487304605, 0.82338775728195235, 1.7879464211173846,
+  // 0.01 dB, rolloff 0
+  -0.35503898263857647, 1.3393638200324232, 7.2151485138314326,
+  -1.0243569589149588, 0.63244234780397135, 3.0588069684294896,
+  // 0.01 dB, rolloff 1
+  -0.39844755090218914, 1.352302894894136, 15.585001358071183,
+  -0.99910365551729863, 0.57600844775663484, 6.4876903527200263,
+  // 0.01 dB, rolloff 2
+  -0.40877011650322637, 1.3549983422311613, 38.090918353625995,
+  -0.99312931170503138, 0.56388554387043266, 15.790907595481935,
+  // 0.01 dB, rolloff 3
+  -0.41055649701166785, 1.3554503511115223, 99.141098057148511,
+  -0.99209799569833135, 0.56183294791753968, 41.070631068231144,
+  // 0.01 dB, rolloff 4
+  -0.41082300833773167, 1.355517423143497, 265.03781490383329,
+  -0.99194420415216911, 0.56152783996519662, 109.78414400486216,
+  // 0.1 dB, rolloff -4
+  -0.026402195356321663, 1.0360557397662897, 1.7081435549827368,
+  -0.54836509830507307, 1.2129912261621922, 1.0526647130865328,
+  // 0.1 dB, rolloff -3
+  -0.062312335549614899, 1.0634473761101397, 2.0456614725101949,
+  -0.69648581758540895, 0.9994966108075487, 1.125963310741581,
+  // 0.1 dB, rolloff -2
+  -0.12363779918845277, 1.092836572787653, 2.6708394881500817,
+  -0.72388808997896714, 0.74748575223575509, 1.3101598792159537,
+  // 0.1 dB, rolloff -1
+  -0.19377322714340245, 1.1126745912451061, 4.0024211001801548,
+  -0.68566068696122595, 0.57585463608359533, 1.7879464211173846,
+  // 0.1 dB, rolloff 0
+  -0.24121773240354619, 1.1203350003862995, 7.2151485138314326,
+  -0.65333420286364541, 0.49661652350387869, 3.0588069684294896,
+  // 0.1 dB, rolloff 1
+  -0.25914796089268127, 1.1221890920448272, 15.585001358071183,
+  -0.64111732406864896, 0.47159723298493306, 6.4876903527200263,
+  // 0.1 dB, rolloff 2
+  -0.26331448832852317, 1.1225420261948833, 38.090918353625995,
+  -0.63829837984031368, 0.46609788388155088, 15.790907595481935,
+  // 0.1 dB, rolloff 3
+  -0.26403200522257697, 1.1225998755335211, 99.141098057148511,
+  -0.63781383876980347, 0.46516207636818696, 41.070631068231144,
+  // 0.1 dB, rolloff 4
+  -0.26413896432354889, 1.1226084255075564, 265.03781490383329,
+  -0.63774163256965333, 0.4650228559287059, 109.78414400486216,
+  // 0.5 dB, rolloff -4
+  -0.030978133012588848, 1.0146983280090067, 1.7081435549827368,
+  -0.47425616428051665, 0.87566799594081202, 1.0526647130865328,
+  // 0.5 dB, rolloff -3
+  -0.059141640868502966, 1.0202474146232976, 2.0456614725101949,
+  -0.49773563769891971, 0.722001232406973, 1.125963310741581,
+  // 0.5 dB, rolloff -2
+  -0.098680862738592709, 1.0227538420115951, 2.6708394881500817,
+  -0.48082638425527102, 0.58217560809721902, 1.3101598792159537,
+  // 0.5 dB, rolloff -1
+  -0.1385379192410105, 1.0209948181458155, 4.0024211001801548,
+  -0.45154798932324824, 0.48672988137103529, 1.7879464211173846,
+  // 0.5 dB, rolloff 0
+  -0.16362532329399429, 1.0180684440336221, 7.2151485138314326,
+  -0.43226103155588291, 0.44016919097497031, 3.0588069684294896,
+  // 0.5 dB, rolloff 1
+  -0.17281216782329167, 1.0166699681908089, 15.585001358071183,
+  -0.42526387512157698, 0.42499092639852326, 6.4876903527200263,
+  // 0.5 dB, rolloff 2
+  -0.17492670120144213, 1.0163237907348039, 38.090918353625995,
+  -0.42366226020052072, 0.42162009354472402, 15.790907595481935,
+  // 0.5 dB, rolloff 3
+  -0.17529010521479602, 1.0162633857731902, 99.141098057148511,
+  -0.42338737496433537, 0.42104520673008206, 41.070631068231144,
+  // 0.5 dB, rolloff 4
+  -0.17534425883497648, 1.0162543615155872, 265.03781490383329,
+  -0.42334642161720248, 0.42095964850931056, 109.78414400486216,
+  // 1 dB, rolloff -4
+  -0.028996653495223804, 1.0047388924276235, 1.7081435549827368,
+  -0.39559206800800284, 0.77267649770917024, 1.0526647130865328,
+  // 1 dB, rolloff -3
+  -0.052023155988174287, 1.0036091283460213, 2.0456614725101949,
+  -0.40013900825960469, 0.64909141668394987, 1.125963310741581,
+  // 1 dB, rolloff -2
+  -0.082738395874147538, 0.99891231979554396, 2.6708394881500817,
+  -0.38186385196971484, 0.53858760577668663, 1.3101598792159537,
+  // 1 dB, rolloff -1
+  -0.11261162305408741, 0.99173804628880458, 4.0024211001801548,
+  -0.35840441695478448, 0.46165370870837052, 1.7879464211173846,
+  // 1 dB, rolloff 0
+  -0.13101780338403912, 0.98620951452550176, 7.2151485138314326,
+  -0.34363331869866309, 0.42333213599990455, 3.0588069684294896,
+  // 1 dB, rolloff 1
+  -0.13769475866783698, 0.98400535281615398, 15.585001358071183,
+  -0.33832597774801315, 0.41070584742996913, 6.4876903527200263,
+  // 1 dB, rolloff 2
+  -0.13922719396867531, 0.98348473812993698, 38.090918353625995,
+  -0.33711369781395106, 0.407892283770251, 15.790907595481935,
+  // 1 dB, rolloff 3
+  -0.13949039735111393, 0.98339476780742208, 99.141098057148511,
+  -0.33690571801431168, 0.40741208811008445, 41.070631068231144,
+  // 1 dB, rolloff 4
+  -0.13952961528362026, 0.98338134816438583, 265.03781490383329,
+  -0.33687473451497379, 0.40734061367383351, 109.78414400486216,
+  // 3 dB, rolloff -4
+  -0.021033466314736925, 0.99136853168419303, 1.7081435549827368,
+  -0.25044753162432831, 0.66540465081808065, 1.0526647130865328,
+  // 3 dB, rolloff -3
+  -0.035335349410084885, 0.98304732578142251, 2.0456614725101949,
+  -0.24581021948709159, 0.57503203048113127, 1.125963310741581,
+  // 3 dB, rolloff -2
+  -0.053418422751956816, 0.97098007099430084, 2.6708394881500817,
+  -0.23237334545874064, 0.49343857648338052, 1.3101598792159537,
+  // 3 dB, rolloff -1
+  -0.070333297228161937, 0.95842113645662552, 4.0024211001801548,
+  -0.21813816271440595, 0.43476670220019659, 1.7879464211173846,
+  // 3 dB, rolloff 0
+  -0.080512183604925958, 0.95032274241407388, 7.2151485138314326,
+  -0.20952470076256907, 0.40475464686166684, 3.0588069684294896,
+  // 3 dB, rolloff 1
+  -0.084166121265314961, 0.94731894447421994, 15.585001358071183,
+  -0.20645889821273425, 0.39473715178318614, 6.4876903527200263,
+  // 3 dB, rolloff 2
+  -0.085002065033449523, 0.94662457958641189, 38.090918353625995,
+  -0.20576011927893373, 0.39249582288958929, 15.790907595481935,
+  // 3 dB, rolloff 3
+  -0.085145544447077934, 0.94650513233390776, 99.141098057148511,
+  -0.20564028621287925, 0.3921129564576093, 41.070631068231144,
+  // 3 dB, rolloff 4
+  -0.085166920773830243, 0.94648732972243377, 265.03781490383329,
+  -0.20562243547454626, 0.39205596055859493, 109.78414400486216,
+};
+
+const double elliptic8[] =
+{
+  // 0.01 dB, rolloff -4
+  -0.012472810359288232, 1.0178310816422769, 3.0804669008534464,
+  -0.064908404059999564, 1.0184819635966309, 1.3149430171476406,
+  -0.25869642400785764, 0.99851360338239314, 1.0859754254621219,
+  -0.85493223648641037, 0.63450685843014532, 1.0378864505964915,
+  // 0.01 dB, rolloff -3
+  -0.026185789798498438, 1.0323426286503585, 3.8028959743988389,
+  -0.11340282969269809, 1.0095131599162586, 1.5179851516436449,
+  -0.33353755355341458, 0.90296596927389872, 1.1818000761226477,
+  -0.73028199964537721, 0.44642360981987933, 1.0994277395154921,
+  // 0.01 dB, rolloff -2
+  -0.047365452853151378, 1.0520509178150375, 5.0892117357040707,
+  -0.17293388092413789, 0.98643870385422272, 1.9181217336300738,
+  -0.38071454288551126, 0.7877686366994997, 1.4042366331119271,
+  -0.61401508011457373, 0.32628206876016752, 1.2632168100772292,
+  // 0.01 dB, rolloff -1
+  -0.07079352967901692, 1.0715488516647245, 7.7563759780265755,
+  -0.22552508876996091, 0.95594511450987962, 2.8066216603202689,
+  -0.3985268460409564, 0.69179656969413406, 1.9535530364243705,
+  -0.53220026164802081, 0.25871141560015337, 1.7029471992224352,
+  // 0.01 dB, rolloff 0
+  -0.086607332265928788, 1.083690760191383, 14.102058633459635,
+  -0.25536738873393289, 0.93419844697554943, 4.9966626304415502,
+  -0.40175504561774145, 0.63962469811147959, 3.3808744271530755,
+  -0.49121147201592757, 0.22864166945826284, 2.891466183915691,
+  // 0.01 dB, rolloff 1
+  -0.092611436559591739, 1.0881152949640889, 30.54772678837336,
+  -0.26571435587007036, 0.92584073607596373, 10.747408531935797,
+  -0.40191073694947588, 0.62185763862759336, 7.2005349134653134,
+  -0.47766749267536457, 0.21917853719617367, 6.1159158029092033,
+  // 0.01 dB, rolloff 2
+  -0.094009993871581959, 1.0891321254534052, 74.708491284083337,
+  -0.26805333136493337, 0.92388993611726011, 26.24249074718967,
+  -0.40188175789552066, 0.61786153491725437, 17.542568952007493,
+  -0.47464661640660921, 0.21709795792820497, 14.87660589359149,
+  // 0.01 dB, rolloff 3
+  -0.094250981325945019, 1.0893068200842173, 194.46859818207528,
+  -0.26845372058336947, 0.92355367991188819, 68.29150013993889,
+  -0.40187446881306083, 0.6171781886476605, 45.633954526775995,
+  -0.47413093331717837, 0.2167438670174982, 38.688416762584339,
+  // 0.01 dB, rolloff 4
+  -0.094286908598904373, 1.0893328512196492, 519.88900583446787,
+  -0.26851334588208636, 0.92350354705644178, 182.56194178745488,
+  -0.40187332532829928, 0.61707644348233326, 121.98512405459208,
+  -0.47405417414431233, 0.21669118752529662, 103.41467478213397,
+  // 0.1 dB, rolloff -4
+  -0.01116443837907998, 1.0076612428852156, 3.0804669008534464,
+  -0.056852594605870645, 0.98666336665775822, 1.3149430171476406,
+  -0.20798400345246726, 0.88789129714531001, 1.0859754254621219,
+  -0.54786788888069859, 0.44972473747712383, 1.0378864505964915,
+  // 0.1 dB, rolloff -3
+  -0.021106086366546952, 1.0130631179072398, 3.8028959743988389,
+  -0.089160441575764249, 0.96634213276262981, 1.5179851516436449,
+  -0.24391563417864742, 0.80396454148800334, 1.1818000761226477,
+  -0.47319820787149097, 0.35218452013367979, 1.0994277395154921,
+  // 0.1 dB, rolloff -2
+  -0.035277895526752763, 1.0199793016799086, 5.0892117357040707,
+  -0.12606652748790481, 0.93605944467489599, 1.9181217336300738,
+  -0.26494398385081463, 0.71361982260653389, 1.4042366331119271,
+  -0.40544972335607626, 0.28045604248698536, 1.2632168100772292,
+  // 0.1 dB, rolloff -1
+  -0.049971637156051893, 1.026483501727979, 7.7563759780265755,
+  -0.15725067628068937, 0.90456671698369107, 2.8066216603202689,
+  -0.27211426313588177, 0.64103555014162061, 1.9535530364243705,
+  -0.35688900583663091, 0.23544185168295201, 1.7029471992224352,
+  // 0.1 dB, rolloff 0
+  -0.059467884207120458, 1.030395055163464, 14.102058633459635,
+  -0.1745996151810667, 0.88447906349518046, 4.9966626304415502,
+  -0.27294031906719279, 0.60173067264358193, 3.3808744271530755,
+  -0.33212173053627847, 0.21406947468654328, 2.891466183915691,
+  // 0.1 dB, rolloff 1
+  -0.062998364586084668, 1.0317965197590997, 30.54772678837336,
+  -0.18057910063425159, 0.87708814576690508, 10.747408531935797,
+  -0.27276706164712944, 0.58831209821031549, 7.2005349134653134,
+  -0.32386611799713932, 0.20715353187525354, 6.1159158029092033,
+  // 0.1 dB, rolloff 2
+  -0.063815219973661755, 1.0321168673046961, 74.708491284083337,
+  -0.18192896838122674, 0.87538468687889404, 26.24249074718967,
+  -0.27269696912923608, 0.58529018016064815, 17.542568952007493,
+  -0.32201975927562265, 0.20562027284448769, 14.87660589359149,
+  // 0.1 dB, rolloff 3
+  -0.063955767746235181, 1.032171839640277, 194.46859818207528,
+  -0.18215998189080579, 0.87509184694917375, 68.29150013993889,
+  -0.27268384433053583, 0.58477326467056012, 45.633954526775995,
+  -0.32170438989582134, 0.20535886797444844, 38.688416762584339,
+  // 0.1 dB, rolloff 4
+  -0.063976715954622843, 1.0321800294213539, 519.88900583446787,
+  -0.18219438261474144, 0.87504820654982041, 182.56194178745488,
+  -0.27268186172615344, 0.58469629577573401, 121.98512405459208,
+  -0.32165744272380903, 0.20531996624455329, 103.41467478213397,
+  // 0.5 dB, rolloff -4
+  -0.0086008794636305876, 1.0017961841968748, 3.0804669008534464,
+  -0.043265394187352431, 0.96898760803106243, 1.3149430171476406,
+  -0.15138407362451423, 0.83400546753484572, 1.0859754254621219,
+  -0.3629181275166084, 0.38444873446969563, 1.0378864505964915,
+  // 0.5 dB, rolloff -3
+  -0.015551918413681975, 1.0027314090777775, 3.8028959743988389,
+  -0.064853593079063007, 0.94420132047500016, 1.5179851516436449,
+  -0.17131071097311792, 0.75849658771840989, 1.1818000761226477,
+  -0.31584554214772353, 0.31577211853956738, 1.0994277395154921,
+  // 0.5 dB, rolloff -2
+  -0.025095200017400773, 1.0037265509165085, 5.0892117357040707,
+  -0.088742356392927782, 0.91152935141709646, 1.9181217336300738,
+  -0.18251872184581841, 0.68007423789289012, 1.4042366331119271,
+  -0.27303685703239061, 0.26126734435543431, 1.2632168100772292,
+  // 0.5 dB, rolloff -1
+  -0.03469017103369914, 1.0044821409516602, 7.7563759780265755,
+  -0.10853559164090633, 0.88009112842040005, 2.8066216603202689,
+  -0.18602007332120707, 0.61772901793565105, 1.9535530364243705,
+  -0.24202034959687013, 0.22506593246701911, 1.7029471992224352,
+  // 0.5 dB, rolloff 0
+  -0.040764429668773756, 1.0048537238179323, 14.102058633459635,
+  -0.11945121599576138, 0.86086499208916878, 4.9966626304415502,
+  -0.18618687466921352, 0.58396082551463191, 3.3808744271530755,
+  -0.22606710612299996, 0.20729795754856223, 2.891466183915691,
+  // 0.5 dB, rolloff 1
+  -0.043000350599136407, 1.0049712661279675, 30.54772678837336,
+  -0.1232031101568859, 0.85391431074393742, 10.747408531935797,
+  -0.18598444743644976, 0.5724128146664289, 7.2005349134653134,
+  -0.22072809962843237, 0.2014657921226406, 6.1159158029092033,
+  // 0.5 dB, rolloff 2
+  -0.043516043673618041, 1.0049969510359273, 74.708491284083337,
+  -0.12404955216172575, 0.85232067698558145, 26.24249074718967,
+  -0.18592107323359222, 0.56981027940757878, 17.542568952007493,
+  -0.21953255141594594, 0.20016727191561687, 14.87660589359149,
+  // 0.5 dB, rolloff 3
+  -0.043604712523481415, 1.005001313976269, 194.46859818207528,
+  -0.12419439235016867, 0.85204702143246425, 68.29150013993889,
+  -0.185909581961581, 0.56936502728840499, 45.633954526775995,
+  -0.21932828994717229, 0.19994568652913325, 38.688416762584339,
+  // 0.5 dB, rolloff 4
+  -0.043617926809502473, 1.0050019628457252, 519.88900583446787,
+  -0.12421596037619788, 0.85200624756980103, 182.56194178745488,
+  -0.18590785466658785, 0.56929872720915209, 121.98512405459208,
+  -0.21929788139073395, 0.19991270564156371, 103.41467478213397,
+  // 1 dB, rolloff -4
+  -0.0071654156715216773, 0.99980233254568296, 3.0804669008534464,
+  -0.035896442513199518, 0.96308632138495576, 1.3149430171476406,
+  -0.12380160683946712, 0.81705489841226975, 1.0859754254621219,
+  -0.28863217750773962, 0.36627794265042307, 1.0378864505964915,
+  // 1 dB, rolloff -3
+  -0.012783618008655758, 0.99931879422457026, 3.8028959743988389,
+  -0.053085345872965803, 0.93703288694857378, 1.5179851516436449,
+  -0.13868244485411857, 0.74445803959503609, 1.1818000761226477,
+  -0.25183241313368693, 0.30525323660708442, 1.0994277395154921,
+  // 1 dB, rolloff -2
+  -0.020406717393349344, 0.99847829915071196, 5.0892117357040707,
+  -0.071922595315312754, 0.90374473658256005, 1.9181217336300738,
+  -0.14693449745214979, 0.66975105441335936, 1.4042366331119271,
+  -0.21830030918353804, 0.25554002622804384, 1.2632168100772292,
+  // 1 dB, rolloff -1
+  -0.02799719894408708, 0.99748518541221021, 7.7563759780265755,
+  -0.087437515786190301, 0.87238736670496397, 2.8066216603202689,
+  -0.14941513526201572, 0.61050450966027525, 1.9535530364243705,
+  -0.19391841952168357, 0.22188760038531768, 1.7029471992224352,
+  // 1 dB, rolloff 0
+  -0.032771320275176818, 0.99679256838188735, 14.102058633459635,
+  -0.095970786672606292, 0.85343982321079914, 4.9966626304415502,
+  -0.14945354267113808, 0.57840260904485463, 3.3808744271530755,
+  -0.181344555015581, 0.20518780499866249, 2.891466183915691,
+  // 1 dB, rolloff 1
+  -0.034523175854543724, 0.99652617297306967, 30.54772678837336,
+  -0.098901322855066115, 0.84662490935922619, 10.747408531935797,
+  -0.14927042302838661, 0.56741760145656484, 7.2005349134653134,
+  -0.17713128420668642, 0.19968032909390124, 6.1159158029092033,
+  // 1 dB, rolloff 2
+  -0.034926821975648184, 0.99646388608672132, 74.708491284083337,
+  -0.09956232744420869, 0.84506480920753024, 26.24249074718967,
+  -0.1492157055960544, 0.56494133472145569, 17.542568952007493,
+  -0.17618745583843012, 0.19845236667574181, 14.87660589359149,
+  // 1 dB, rolloff 3
+  -0.034996210346246621, 0.99645314478636904, 194.46859818207528,
+  -0.099675431694887642, 0.84479699989590862, 68.29150013993889,
+  -0.14920585249011986, 0.56451766110781709, 45.633954526775995,
+  -0.17602618782546742, 0.19824275864290439, 38.688416762584339,
+  // 1 dB, rolloff 4
+  -0.035006550893682757, 0.99645154322146356, 519.88900583446787,
+  -0.099692273839257994, 0.84475709929930654, 182.56194178745488,
+  -0.14920437304472145, 0.56445457355919049, 121.98512405459208,
+  -0.17600217940429877, 0.19821155890267728, 103.41467478213397,
+  // 3 dB, rolloff -4
+  -0.0046045844182423966, 0.99745468029321915, 3.0804669008534464,
+  -0.022956612231129356, 0.95620625655337899, 1.3149430171476406,
+  -0.077874375307306135, 0.79790192119131187, 1.0859754254621219,
+  -0.17608639596402409, 0.3469139813891709, 1.0378864505964915,
+  // 3 dB, rolloff -3
+  -0.0080934559264593479, 0.99535781455948502, 3.8028959743988389,
+  -0.03344623387854153, 0.92880032502408727, 1.5179851516436449,
+  -0.086287696535677985, 0.72872314759242096, 1.1818000761226477,
+  -0.15408572069688894, 0.29383667352654569, 1.0994277395154921,
+  // 3 dB, rolloff -2
+  -0.012764735510868349, 0.99245552075284649, 5.0892117357040707,
+  -0.044818374435662889, 0.89489129236635678, 1.9181217336300738,
+  -0.090871810021786736, 0.65819194610914866, 1.4042366331119271,
+  -0.13398276801506892, 0.24922251893257516, 1.2632168100772292,
+  // 3 dB, rolloff -1
+  -0.01736521047251692, 0.98951701928299596, 7.7563759780265755,
+  -0.054122776997022191, 0.86366033663966257, 2.8066216603202689,
+  -0.092177996172409696, 0.60238325760153055, 1.9535530364243705,
+  -0.11930529714075062, 0.21833584592914973, 1.7029471992224352,
+  // 3 dB, rolloff 0
+  -0.020237464803440137, 0.98764755150356642, 14.102058633459635,
+  -0.059224900689165035, 0.84503213052678583, 4.9966626304415502,
+  -0.092136621624743134, 0.57212555277955246, 3.3808744271530755,
+  -0.11171349376946507, 0.20280921856845363, 2.891466183915691,
+  // 3 dB, rolloff 1
+  -0.021287704676820635, 0.98695771167527724, 30.54772678837336,
+  -0.060975409594386208, 0.83836937779124154, 10.747408531935797,
+  -0.092009549968435397, 0.5617637168069799, 7.2005349134653134,
+  -0.10916606932533487, 0.1976602884169559, 6.1159158029092033,
+  // 3 dB, rolloff 2
+  -0.021529418406053616, 0.98679848022607153, 74.708491284083337,
+  -0.061370157565508086, 0.83684667652926159, 26.24249074718967,
+  -0.091973160721545891, 0.55942723713466924, 17.542568952007493,
+  -0.10859516611807253, 0.19651036988529488, 14.87660589359149,
+  // 3 dB, rolloff 3
+  -0.021570959788414251, 0.98677109703153798, 194.46859818207528,
+  -0.061437699638539837, 0.83658538101992819, 68.29150013993889,
+  -0.091966651451350662, 0.55902745336063897, 45.633954526775995,
+  -0.10849760922881915, 0.1963140146591123, 38.688416762584339,
+  // 3 dB, rolloff 4
+  -0.021577150205553106, 0.98676701600471073, 519.88900583446787,
+  -0.061447757127477631, 0.8365464532489405, 182.56194178745488,
+  -0.091965675112209946, 0.55896792247435612, 121.98512405459208,
+  -0.10848308543547343, 0.19628478585463871, 103.41467478213397,
+};
+
+struct PrototypeTable
+{
+  PrototypeFamily family;
+  int numPoles;
+  const double* poles;
+};
+
+const PrototypeTable tables[] =
+{
+  { prototypeButterworth, 2, butterworth2 },
+  { prototypeButterworth, 4, butterworth4 },
+  { prototypeButterworth, 8, butterworth8 },
+  { prototypeBessel, 2, bessel2 },
+  { prototypeBessel, 4, bessel4 },
+  { prototypeBessel, 8, bessel8 },
+  { prototypeLegendre, 2, legendre2 },
+  { prototypeLegendre, 4, legendre4 },
+  { prototypeLegendre, 8, legendre8 },
+};
+
+struct EllipticTable
+{
+  int numPoles;
+  const double* prototypes;
+};
+
+const EllipticTable ellipticTables[] =
+{
+  { 2, elliptic2 },
+  { 4, elliptic4 },
+  { 8, elliptic8 },
+};
+
+}
+
+bool loadPrototypeTable (PrototypeFamily family,
+                         int numPoles,
+                         LayoutBase& layout)
+{
+  for (size_t i = 0; i < sizeof (tables) / sizeof (tables[0]); ++i)
+  {
+    const PrototypeTable& table = tables[i];
+    if (table.family != family || table.numPoles != numPoles)
+      continue;
+
+    layout.reset ();
+    for (int j = 0; j < numPoles / 2; ++j)
+      layout.addPoleZeroConjugatePairs (
+        complex_t (table.poles[2*j], table.poles[2*j+1]), infinity());
+
+    return true;
+  }
+
+  return false;
+}
+
+bool loadEllipticPrototypeTable (int numPoles,
+                                 double rippleDb,
+                                 double rolloff,
+                                 LayoutBase& layout)
+{
+  const int rippleCount = sizeof (ellipticRipples) / sizeof (ellipticRipples[0]);
+  const int rolloffCount = ellipticRolloffMax - ellipticRolloffMin + 1;
+
+  int ripple = 0;
+  while (ripple < rippleCount && ellipticRipples[ripple] != rippleDb)
+    ++ripple;
+
+  if (ripple == rippleCount ||
+      rolloff < ellipticRolloffMin ||
+      rolloff > ellipticRolloffMax ||
+      rolloff != std::floor (rolloff))
+    return false;
+
+  for (size_t i = 0; i < sizeof (ellipticTables) / sizeof (ellipticTables[0]); ++i)
+  {
+    const EllipticTable& table = ellipticTables[i];
+    if (table.numPoles != numPoles)
+      continue;
+
+    const int entry = ripple * rolloffCount + int (rolloff) - ellipticRolloffMin;
+    const double* p = table.prototypes + entry * (numPoles / 2) * 3;
+
+    layout.reset ();
+    for (int j = 0; j < numPoles / 2; ++j)
+      layout.addPoleZeroConjugatePairs (
+        complex_t (p[3*j], p[3*j+1]), complex_t (0, p[3*j+2]));
+
+    return true;
+  }
+
+  return false;
+}
+
+}
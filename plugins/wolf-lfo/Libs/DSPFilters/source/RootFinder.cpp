@@ -35,11 +35,10 @@ THE SOFTWARE.
 
 #include "DspFilters/Common.h"
 #include "DspFilters/RootFinder.h"
-#include <stdexcept>
 
 namespace Dsp {
 
-void RootFinderBase::solve (int degree,
+bool RootFinderBase::solve (int degree,
                             bool polish,
                             bool doSort)
 {
@@ -51,6 +50,7 @@ void RootFinderBase::solve (int degree,
   complex_t x, b, c;
 
   int m = degree;
+  bool converged = true;
 
   // copy coefficients
   for (int j = 0; j <= m; ++j)
@@ -61,7 +61,7 @@ void RootFinderBase::solve (int degree,
   {
     // initial guess at 0
     x = 0.0;
-    laguerre (j + 1, m_ad, x, its);
+    converged &= laguerre (j + 1, m_ad, x, its);
     
     if (fabs (std::imag(x)) <= 2.0 * EPS * fabs (std::real(x)))
       x = complex_t (std::real(x), 0.0);
@@ -80,10 +80,12 @@ void RootFinderBase::solve (int degree,
 
   if (polish)
     for (int j = 0; j < m; ++j)
-      laguerre (degree, m_a, m_root[j], its);
+      converged &= laguerre (degree, m_a, m_root[j], its);
 
   if (doSort)
     sort (degree);
+
+  return converged;
 }
 
 void RootFinderBase::sort (int degree)
@@ -107,7 +109,7 @@ void RootFinderBase::sort (int degree)
 
 //------------------------------------------------------------------------------
 
-void RootFinderBase::laguerre (int degree,
+bool RootFinderBase::laguerre (int degree,
                            complex_t a[],
                            complex_t& x,
                            int& its)
@@ -137,7 +139,7 @@ void RootFinderBase::laguerre (int degree,
     }
     err *= EPS;
     if (std::abs(b) <= err)
-      return;
+      return true;
     g  = d / b;
     g2 = g * g;
     h  = g2 - 2.0 * f / b;
@@ -153,14 +155,15 @@ void RootFinderBase::laguerre (int degree,
     dx = std::max(abp, abm) > 0.0 ? double(m) / gp : std::polar (1 + abx, double(iter));
     x1 = x - dx;
     if (x == x1)
-      return;
+      return true;
     if (iter % MT != 0)
       x = x1;
     else
       x -= frac[iter / MT] * dx;
   }
 
-  throw std::logic_error ("laguerre failed");
+  // laguerre failed
+  return false;
 }
 
 //------------------------------------------------------------------------------
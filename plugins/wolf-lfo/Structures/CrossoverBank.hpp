@@ -0,0 +1,96 @@
+#ifndef WOLF_CROSSOVER_BANK_HPP_INCLUDED
+#define WOLF_CROSSOVER_BANK_HPP_INCLUDED
+
+#include "DspFilters/Simd.h"
+
+namespace wolf
+{
+/**
+ * Splits a stereo signal into 2 to 4 bands with Linkwitz-Riley crossovers.
+ *
+ * Every band is its own chain of biquads fed by the input: two Butterworth
+ * sections per crossover it sits next to, plus the matching allpass for the
+ * crossovers of the other branch, so the bands sum back to an allpass of the input.
+ * All the chains run together as a single cascade, one SIMD vector per band
+ * holding both channels, with coefficients that differ per band.
+ */
+class CrossoverBank
+{
+  public:
+    static const int maxBands = 4;
+    static const int maxStages = 5;
+
+    CrossoverBank();
+
+    /**
+     * frequencies holds bandCount - 1 crossover frequencies in Hz, from low to high.
+     * The filter state is kept, so this can be called while audio is running.
+     */
+    void setup(int bandCount, const float *frequencies, double sampleRate);
+
+    void reset();
+
+    int getBandCount() const
+    {
+        return bandCount;
+    }
+
+    /**
+     * Splits one stereo frame, writing band i to left[i] and right[i].
+     */
+    void process(float inputL, float inputR, float *left, float *right)
+    {
+        Dsp::double2 x[maxBands];
+
+        for (int i = 0; i < bandCount; ++i)
+        {
+            x[i] = Dsp::double2::set(inputL, inputR);
+        }
+
+        // transposed direct form II
+        for (int s = 0; s < stageCount; ++s)
+        {
+            for (int i = 0; i < bandCount; ++i)
+            {
+                const Dsp::double2 y = b0[s][i] * x[i] + z1[s][i];
+                z1[s][i] = b1[s][i] * x[i] - a1[s][i] * y + z2[s][i];
+                z2[s][i] = b2[s][i] * x[i] - a2[s][i] * y;
+                x[i] = y;
+            }
+        }
+
+        for (int i = 0; i < bandCount; ++i)
+        {
+            double out[2];
+            x[i].store(out);
+
+            left[i] = out[0];
+            right[i] = out[1];
+        }
+    }
+
+  private:
+    struct Section
+    {
+        double b0, b1, b2, a1, a2;
+    };
+
+    void addSplit(int firstBand, int lastBand, const Section *lowPass, const Section *highPass, const Section *allPass);
+    void addSection(int band, const Section &section);
+
+    int bandCount;
+    int stageCount;
+    int bandStageCount[maxBands];
+
+    Dsp::double2 b0[maxStages][maxBands];
+    Dsp::double2 b1[maxStages][maxBands];
+    Dsp::double2 b2[maxStages][maxBands];
+    Dsp::double2 a1[maxStages][maxBands];
+    Dsp::double2 a2[maxStages][maxBands];
+
+    Dsp::double2 z1[maxStages][maxBands];
+    Dsp::double2 z2[maxStages][maxBands];
+};
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef WOLF_ENVELOPE_FITTER_HPP_INCLUDED
+#define WOLF_ENVELOPE_FITTER_HPP_INCLUDED
+
+#include "Graph.hpp"
+#include "WavReader.hpp"
+
+#include <stdint.h>
+
+namespace wolf
+{
+/**
+ * Turns the amplitude envelope of some audio into a graph.
+ *
+ * Audio is streamed in with process(). Each frame is folded onto one period
+ * (for example one bar) and accumulated into a fixed number of bins, so memory
+ * use doesn't depend on the length of the material. Averaging several periods
+ * gives a cleaner envelope.
+ *
+ * fit() then simplifies the envelope with Ramer-Douglas-Peucker and fits the
+ * curve type and the tension of each remaining segment.
+ *
+ * fitFile() streams a WAV file through the same steps. It is shared by the
+ * envelope-to-graph tool and the editor's import action.
+ */
+class EnvelopeFitter
+{
+  public:
+    static const int resolution = 512;
+    static const int maxFittedVertices = 64;
+    static const int blockSize = 1024;
+
+    EnvelopeFitter();
+
+    /**
+     * Starts a new analysis. periodFrames is the length of the graph, in frames.
+     */
+    void reset(uint64_t periodFrames);
+
+    void process(const float *const *channels, int channelCount, int frames);
+
+    /**
+     * Fits the envelope analyzed so far.
+     * tolerance is the maximum distance allowed between the envelope and the
+     * simplified graph, in graph units. It is raised when the result would
+     * need more than maxFittedVertices vertices.
+     * Returns the graph in the format accepted by Graph::rebuildFromString().
+     */
+    const char *fit(float tolerance);
+
+    /**
+     * Analyzes a whole WAV file and fits it, reading it one block at a time.
+     * periodSeconds is the length of the graph, such as one bar at the tempo of the
+     * material. With 0, the whole file is folded onto the graph.
+     * Returns NULL if the file can't be read.
+     */
+    const char *fitFile(const char *path, double periodSeconds, float tolerance);
+
+  private:
+    void computeEnvelope();
+    int simplify(float tolerance);
+    float fitTension(int start, int end, int curveType, float &error);
+    float getSegmentError(int start, int end, float tension, int curveType);
+
+    uint64_t periodFrames;
+    uint64_t position;
+
+    double sums[resolution];
+    uint32_t counts[resolution];
+
+    // envelope mapped to graph values, closed by the value of the first bin
+    float envelope[resolution + 1];
+
+    bool keep[resolution + 1];
+    int stack[2 * (resolution + 1)];
+
+    int vertexIndices[maxFittedVertices];
+    float vertexTensions[maxFittedVertices];
+    int vertexCurveTypes[maxFittedVertices];
+
+    float blocks[WavReader::maxChannels][blockSize];
+
+    // two-vertex graph used to evaluate the curve of a segment
+    Graph segmentGraph;
+    char segmentBuffer[128];
+
+    char serializationBuffer[maxFittedVertices * 64 + 1];
+};
+}
+
+#endif
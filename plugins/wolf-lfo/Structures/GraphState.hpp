@@ -0,0 +1,24 @@
+#ifndef WOLF_GRAPH_STATE_HPP_INCLUDED
+#define WOLF_GRAPH_STATE_HPP_INCLUDED
+
+#include "Graph.hpp"
+
+namespace wolf
+{
+// Same capacity as wolf::Graph
+const int maxStateVertices = maxVertices;
+
+// Longest state accepted; a vertex takes at most ~60 characters when serialized with %a
+const int maxStateLength = maxStateVertices * 64;
+
+/**
+ * Checks a serialized graph ("x,y,tension,type;" for each vertex) before it
+ * is handed to Graph::rebuildFromString().
+ * States come from project files, so they can't be trusted. The check reads
+ * each character at most a few times and never allocates, so malformed input
+ * is rejected in time proportional to maxStateLength.
+ */
+bool validateGraphState(const char *state);
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef WOLF_LINEAR_PHASE_CROSSOVER_HPP_INCLUDED
+#define WOLF_LINEAR_PHASE_CROSSOVER_HPP_INCLUDED
+
+#include "CrossoverBank.hpp"
+
+#include "DspFilters/Butterworth.h"
+#include "DspFilters/LinearPhase.h"
+
+#include <vector>
+
+namespace wolf
+{
+/**
+ * Splits a stereo signal into 2 to 4 bands that all keep the phase of the input.
+ *
+ * Each crossover is a linear phase version of a Butterworth low pass. Band i is
+ * the low pass of crossover i minus the one of crossover i - 1, and the top band
+ * is the delayed input minus the last low pass, so the bands sum back to the input
+ * delayed by getLatency() samples.
+ */
+class LinearPhaseCrossover
+{
+  public:
+    static const int maxBands = CrossoverBank::maxBands;
+    static const int kernelLength = 1023;
+    static const int partitionSize = 128;
+
+    LinearPhaseCrossover();
+
+    /**
+     * frequencies holds bandCount - 1 crossover frequencies in Hz, from low to high.
+     * Redesigns the kernels without allocating, the switch is not smoothed.
+     */
+    void setup(int bandCount, const float *frequencies, double sampleRate);
+
+    void reset();
+
+    int getBandCount() const
+    {
+        return bandCount;
+    }
+
+    /**
+     * Delay of every band, in samples.
+     */
+    int getLatency() const
+    {
+        return lowPasses[0].getLatency();
+    }
+
+    /**
+     * Splits a block of frames, writing band i to left[i] and right[i].
+     */
+    void process(const float *inputL, const float *inputR, int frames, float *const *left, float *const *right);
+
+  private:
+    struct LowPass : Dsp::LinearPhaseFilterDesign<Dsp::Butterworth::Design::LowPass<4>, 2>
+    {
+        LowPass() : Dsp::LinearPhaseFilterDesign<Dsp::Butterworth::Design::LowPass<4>, 2>(kernelLength, partitionSize)
+        {
+        }
+    };
+
+    int bandCount;
+
+    LowPass lowPasses[maxBands - 1];
+
+    // input delayed as much as the low passes, for the top band
+    std::vector<float> delayLines[2];
+    int delayPosition;
+};
+}
+
+#endif
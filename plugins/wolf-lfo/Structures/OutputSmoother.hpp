@@ -0,0 +1,101 @@
+#ifndef WOLF_OUTPUT_SMOOTHER_HPP_INCLUDED
+#define WOLF_OUTPUT_SMOOTHER_HPP_INCLUDED
+
+namespace wolf
+{
+enum SmoothingMode
+{
+    smoothingOnePole = 0,
+    smoothingTwoPole,
+    smoothingButterworth,
+    smoothingSlew,
+    smoothingModeCount
+};
+
+/**
+ * Smooths the gain curve before it is applied to the audio.
+ *
+ * The one-pole mode matches ParamSmooth. The two-pole mode is two of those in series,
+ * critically damped so it never overshoots. The Butterworth mode is steeper but rings
+ * a little. The slew limiter moves linearly, with separate times for rising and falling,
+ * which gives a clean attack and a slow release for pumping effects.
+ *
+ * Coefficients are cached: setup() only recomputes them when its arguments change,
+ * so it can be called at the start of every block.
+ */
+class OutputSmoother
+{
+  public:
+    OutputSmoother();
+
+    /**
+     * frequency is the cutoff of the filter modes, in Hz.
+     * riseTime and fallTime are the slew limiter times for a full 0 to 1 swing, in milliseconds.
+     */
+    void setup(SmoothingMode mode, float frequency, float riseTime, float fallTime, double sampleRate);
+
+    void reset(float value);
+
+    float process(float target)
+    {
+        switch (mode)
+        {
+        case smoothingOnePole:
+            z1 = target * b + z1 * a;
+            return z1;
+
+        case smoothingTwoPole:
+            z1 = target * b + z1 * a;
+            z2 = z1 * b + z2 * a;
+            return z2;
+
+        case smoothingButterworth:
+        {
+            // transposed direct form II
+            const double y = b0 * target + s1;
+            s1 = b1 * target - a1 * y + s2;
+            s2 = b2 * target - a2 * y;
+            z1 = y;
+            return z1;
+        }
+
+        case smoothingSlew:
+            if (target > z1)
+                z1 = z1 + riseStep < target ? z1 + riseStep : target;
+            else
+                z1 = z1 - fallStep > target ? z1 - fallStep : target;
+            return z1;
+
+        case smoothingModeCount:
+            break;
+        }
+
+        return target;
+    }
+
+  private:
+    void calculateCoefficients();
+
+    SmoothingMode mode;
+    float frequency;
+    float riseTime;
+    float fallTime;
+    double sampleRate;
+
+    // one and two-pole, slew limiter
+    float a;
+    float b;
+    float riseStep;
+    float fallStep;
+
+    // z1 also holds the last output of the Butterworth and slew modes
+    float z1;
+    float z2;
+
+    // Butterworth, in double since the cutoff is far below the sample rate
+    double b0, b1, b2, a1, a2;
+    double s1, s2;
+};
+}
+
+#endif
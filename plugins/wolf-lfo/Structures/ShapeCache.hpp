@@ -0,0 +1,95 @@
+#ifndef WOLF_SHAPE_CACHE_HPP_INCLUDED
+#define WOLF_SHAPE_CACHE_HPP_INCLUDED
+
+#include "ShapeTable.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+namespace wolf
+{
+/**
+ * A baked shape shared between every plugin instance of the process.
+ * The table must not be modified once the shape has been handed out.
+ */
+class SharedShape
+{
+  public:
+    const ShapeTable &getTable() const;
+
+  private:
+    friend class ShapeCache;
+
+    SharedShape(bool cached);
+
+    ShapeTable table;
+
+    std::atomic<uint64_t> key;
+
+    // -1 while the cache is rebaking the entry
+    mutable std::atomic<int> refCount;
+
+    const bool cached;
+    SharedShape *nextGarbage;
+};
+
+/**
+ * Process-wide cache of baked shapes, keyed by a hash of the serialized graph
+ * and the warp settings, so identical presets share a single table.
+ *
+ * Entries with no references stay in the cache until their slot is needed
+ * for another shape. They are recycled in place and never freed while the
+ * cache exists, which keeps the lookups lock-free.
+ */
+class ShapeCache
+{
+  public:
+    static ShapeCache &getInstance();
+
+    static uint64_t hashGraph(const char *serializedGraph);
+    static uint64_t makeKey(uint64_t graphHash, WarpType warpType, float warpAmount);
+
+    /**
+     * Warp amounts are rounded before baking, so that instances with
+     * nearly identical settings share the same table.
+     */
+    static float quantizeWarpAmount(float warpAmount);
+
+    /**
+     * Lock-free lookup, safe to call from the audio thread.
+     * Returns a new reference to the shape, or NULL if it hasn't been baked yet.
+     */
+    const SharedShape *find(uint64_t key);
+
+    /**
+     * Returns a new reference to the shape, baking it from the graph on a miss.
+     * May allocate and lock, so it must not be called from the audio thread.
+     */
+    const SharedShape *acquire(uint64_t key, Graph &graph, WarpType warpType, float warpAmount);
+
+    /**
+     * Drops a reference obtained from find() or acquire(). Lock-free.
+     */
+    void release(const SharedShape *shape);
+
+  private:
+    ShapeCache();
+    ~ShapeCache();
+
+    bool tryRetain(const SharedShape *shape);
+    void collectGarbage();
+
+    static const int slotCount = 256;
+    static const int probeCount = 16;
+
+    std::atomic<SharedShape *> slots[slotCount];
+
+    // Uncached shapes waiting to be freed outside of the audio thread
+    std::atomic<SharedShape *> garbage;
+
+    std::mutex writerMutex;
+};
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef WOLF_SHAPE_SLOT_HPP_INCLUDED
+#define WOLF_SHAPE_SLOT_HPP_INCLUDED
+
+#include "Graph.hpp"
+#include "ShapeTable.hpp"
+#include "ShapeCache.hpp"
+
+#include <stdint.h>
+
+namespace wolf
+{
+/**
+ * A graph stored in the plugin state, along with the baked shape the audio thread plays.
+ *
+ * setGraph() is called from the message thread, while the audio thread is locked out.
+ * The audio thread then picks up the new graph with commitPendingGraph().
+ */
+class ShapeSlot
+{
+  public:
+    ShapeSlot();
+    ~ShapeSlot();
+
+    /**
+     * Returns false, keeping the current graph, if the state is malformed.
+     */
+    bool setGraph(const char *serializedGraph, WarpType warpType, float warpAmount);
+
+    bool hasPendingGraph() const;
+    void commitPendingGraph();
+
+    /**
+     * Makes the shape match the given warp settings.
+     * Uses the shape cache when possible, otherwise rebakes the graph.
+     */
+    void setWarp(WarpType warpType, float warpAmount);
+
+    /**
+     * Graph output with the given warp, read from the table of the unwarped graph.
+     * The warp moves the vertices and stretches each segment between them, so x
+     * only has to be mapped back into its segment as it was before the warp.
+     * Used while the warp amount is moving, so it doesn't step at block boundaries.
+     */
+    float getWarpedValueAt(float x, WarpType warpType, float warpAmount);
+
+    /**
+     * Statistics of the graph with the given warp.
+     * The warp only stretches the segments, so the statistics of each segment,
+     * measured once on the unwarped table when the graph is set, are weighted
+     * by its warped width. Cheap enough for the audio thread.
+     */
+    ShapeStatistics getStatistics(WarpType warpType, float warpAmount);
+
+    const ShapeTable &getTable() const
+    {
+        return *shape;
+    }
+
+  private:
+    ShapeSlot(const ShapeSlot &);
+    ShapeSlot &operator=(const ShapeSlot &);
+
+    void storeUnwarpedVertices();
+
+    static void measureSegments(Graph &graph, const ShapeTable &unwarpedTable, ShapeStatistics *statistics);
+
+    Graph graph;
+    Graph tempGraph;
+    bool mustCopyGraph;
+
+    // baked on the audio thread when a warp change misses the cache
+    ShapeTable privateShape;
+
+    // the default graph without warp, until a state is committed
+    ShapeTable privateUnwarpedShape;
+
+    const ShapeTable *shape;
+    const SharedShape *sharedShape;
+    const SharedShape *tempSharedShape;
+
+    const ShapeTable *unwarpedShape;
+    const SharedShape *unwarpedSharedShape;
+    const SharedShape *tempUnwarpedSharedShape;
+
+    // vertex positions of the committed graph without warp
+    float unwarpedX[maxVertices];
+
+    // segment of the last warped lookup, the playhead rarely leaves it
+    int warpedSegment;
+
+    ShapeStatistics segmentStatistics[maxVertices];
+    ShapeStatistics tempSegmentStatistics[maxVertices];
+
+    uint64_t graphHash;
+    uint64_t tempGraphHash;
+};
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef WOLF_SHAPE_TABLE_HPP_INCLUDED
+#define WOLF_SHAPE_TABLE_HPP_INCLUDED
+
+#include "Graph.hpp"
+
+namespace wolf
+{
+/**
+ * Statistics of a shape over a range of x. The integral is over the range,
+ * the other values are averaged over its width.
+ */
+struct ShapeStatistics
+{
+    float min;
+    float max;
+    float mean;
+    float rms;
+    float integral;
+
+    // Mean of the gain curve (e^y - 1) / (e - 1) applied by the plugin
+    float meanGain;
+};
+
+/**
+ * The output of a graph, sampled at a fixed resolution.
+ * Baking walks the graph once, so reading the table on the audio thread
+ * costs the same whatever the number of vertices.
+ */
+class ShapeTable
+{
+  public:
+    static const int size = 2048;
+
+    ShapeTable();
+
+    /**
+     * Sample the graph with the given horizontal warp applied.
+     * The graph's warp settings are changed by this call.
+     */
+    void bake(Graph &graph, WarpType warpType, float warpAmount);
+
+    /**
+     * Linearly interpolated graph output at x, in the range [0, 1].
+     */
+    float getValueAt(float x) const
+    {
+        float position = x * size;
+
+        if (position < 0.0f)
+            position = 0.0f;
+        else if (position > size)
+            position = size;
+
+        int index = (int)position;
+
+        if (index >= size)
+            index = size - 1;
+
+        const float frac = position - index;
+
+        return values[index] + (values[index + 1] - values[index]) * frac;
+    }
+
+    WarpType getWarpType() const;
+    float getWarpAmount() const;
+
+    /**
+     * Exact statistics of the table between x1 and x2, in one pass over the entries in that range.
+     * The table is linear between its entries, so each one adds a closed-form term.
+     * Too slow for the audio thread, bake() leaves it to the caller.
+     */
+    ShapeStatistics getStatistics(float x1, float x2) const;
+
+  private:
+    double getValueAtPosition(double position) const;
+
+    float values[size + 1];
+
+    WarpType warpType;
+    float warpAmount;
+};
+}
+
+#endif
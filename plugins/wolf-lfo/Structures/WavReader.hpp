@@ -0,0 +1,58 @@
+#ifndef WOLF_WAV_READER_HPP_INCLUDED
+#define WOLF_WAV_READER_HPP_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+
+namespace wolf
+{
+/**
+ * Reads a WAV file block by block, with a fixed amount of memory whatever its length.
+ * Handles integer PCM from 8 to 32 bits and 32 or 64-bit float, in plain or extensible headers.
+ */
+class WavReader
+{
+  public:
+    static const int maxChannels = 8;
+
+    WavReader();
+    ~WavReader();
+
+    /**
+     * Returns false if the file can't be opened or isn't a supported WAV file.
+     */
+    bool open(const char *path);
+    void close();
+
+    int getChannelCount() const;
+    double getSampleRate() const;
+    uint64_t getFrameCount() const;
+
+    /**
+     * Reads up to maxFrames frames, one buffer per channel, and converts them to [-1, 1].
+     * Returns the number of frames read, 0 at the end of the file.
+     */
+    int read(float *const *channels, int maxFrames);
+
+  private:
+    WavReader(const WavReader &);
+    WavReader &operator=(const WavReader &);
+
+    bool readHeader();
+    float decodeSample(const unsigned char *bytes) const;
+
+    FILE *file;
+
+    int channelCount;
+    double sampleRate;
+    int bytesPerSample;
+    bool isFloat;
+
+    uint64_t frameCount;
+    uint64_t framesLeft;
+
+    unsigned char buffer[4096];
+};
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include "CrossoverBank.hpp"
+
+#include "DspFilters/Butterworth.h"
+
+#include <algorithm>
+
+namespace wolf
+{
+CrossoverBank::CrossoverBank() : bandCount(1),
+                                 stageCount(0)
+{
+    reset();
+}
+
+void CrossoverBank::setup(int bandCount, const float *frequencies, double sampleRate)
+{
+    bandCount = std::max(1, std::min(bandCount, (int)maxBands));
+
+    Section lowPass[maxBands - 1] = {};
+    Section highPass[maxBands - 1] = {};
+    Section allPass[maxBands - 1] = {};
+
+    float previousFrequency = 0.0f;
+
+    for (int i = 0; i < bandCount - 1; ++i)
+    {
+        // keep the crossovers in order and below nyquist
+        const float frequency = std::min(std::max(frequencies[i], previousFrequency), (float)(sampleRate * 0.45));
+        previousFrequency = frequency;
+
+        Dsp::Butterworth::LowPass<2> lowPassDesign;
+        Dsp::Butterworth::HighPass<2> highPassDesign;
+
+        lowPassDesign.setup(2, sampleRate, frequency);
+        highPassDesign.setup(2, sampleRate, frequency);
+
+        const Dsp::Cascade::Stage &lp = lowPassDesign[0];
+        const Dsp::Cascade::Stage &hp = highPassDesign[0];
+
+        const Section lowPassSection = {lp.m_b0, lp.m_b1, lp.m_b2, lp.m_a1, lp.m_a2};
+        const Section highPassSection = {hp.m_b0, hp.m_b1, hp.m_b2, hp.m_a1, hp.m_a2};
+
+        // LR4 low + high pass is the 2nd order allpass sharing their poles,
+        // whose numerator is the reversed denominator
+        const Section allPassSection = {lp.m_a2, lp.m_a1, 1.0, lp.m_a1, lp.m_a2};
+
+        lowPass[i] = lowPassSection;
+        highPass[i] = highPassSection;
+        allPass[i] = allPassSection;
+    }
+
+    if (bandCount != this->bandCount)
+    {
+        reset();
+    }
+
+    this->bandCount = bandCount;
+    stageCount = 0;
+
+    for (int i = 0; i < maxBands; ++i)
+    {
+        bandStageCount[i] = 0;
+    }
+
+    addSplit(0, bandCount - 1, lowPass, highPass, allPass);
+
+    // pad the shorter chains with pass-through sections
+    const Section identity = {1.0, 0.0, 0.0, 0.0, 0.0};
+
+    for (int i = 0; i < bandCount; ++i)
+    {
+        stageCount = std::max(stageCount, bandStageCount[i]);
+    }
+
+    for (int i = 0; i < bandCount; ++i)
+    {
+        while (bandStageCount[i] < stageCount)
+        {
+            addSection(i, identity);
+        }
+    }
+}
+
+void CrossoverBank::reset()
+{
+    for (int s = 0; s < maxStages; ++s)
+    {
+        for (int i = 0; i < maxBands; ++i)
+        {
+            z1[s][i] = Dsp::double2::zero();
+            z2[s][i] = Dsp::double2::zero();
+        }
+    }
+}
+
+// Splits the bands at the middle crossover, then each half recursively.
+// Crossover i sits between band i and band i + 1.
+void CrossoverBank::addSplit(int firstBand, int lastBand, const Section *lowPass, const Section *highPass, const Section *allPass)
+{
+    if (firstBand == lastBand)
+        return;
+
+    const int middle = (firstBand + lastBand) / 2;
+
+    for (int band = firstBand; band <= lastBand; ++band)
+    {
+        const bool low = band <= middle;
+        const Section &section = low ? lowPass[middle] : highPass[middle];
+
+        addSection(band, section);
+        addSection(band, section);
+
+        // match the phase of the crossovers the other half goes through
+        const int first = low ? middle + 1 : firstBand;
+        const int last = low ? lastBand - 1 : middle - 1;
+
+        for (int i = first; i <= last; ++i)
+        {
+            addSection(band, allPass[i]);
+        }
+    }
+
+    addSplit(firstBand, middle, lowPass, highPass, allPass);
+    addSplit(middle + 1, lastBand, lowPass, highPass, allPass);
+}
+
+void CrossoverBank::addSection(int band, const Section &section)
+{
+    const int stage = bandStageCount[band]++;
+
+    b0[stage][band] = Dsp::double2::set1(section.b0);
+    b1[stage][band] = Dsp::double2::set1(section.b1);
+    b2[stage][band] = Dsp::double2::set1(section.b2);
+    a1[stage][band] = Dsp::double2::set1(section.a1);
+    a2[stage][band] = Dsp::double2::set1(section.a2);
+}
+}
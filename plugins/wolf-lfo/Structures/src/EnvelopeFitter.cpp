@@ -0,0 +1,293 @@
+#include "EnvelopeFitter.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+namespace wolf
+{
+// Graph tensions go from -maxTension to +maxTension
+static const float maxTension = 100.0f;
+
+// Curve types of wolf::Graph as serialized: the single power curve and the
+// S-shaped double curve. Stairs and waves don't follow an envelope.
+static const int straightCurveType = 0;
+static const int fittedCurveTypes[] = {0, 1};
+static const int fittedCurveTypeCount = 2;
+
+EnvelopeFitter::EnvelopeFitter() : periodFrames(1),
+                                   position(0)
+{
+    reset(1);
+}
+
+void EnvelopeFitter::reset(uint64_t periodFrames)
+{
+    this->periodFrames = periodFrames > 0 ? periodFrames : 1;
+    position = 0;
+
+    for (int i = 0; i < resolution; ++i)
+    {
+        sums[i] = 0.0;
+        counts[i] = 0;
+    }
+
+    serializationBuffer[0] = '\0';
+}
+
+void EnvelopeFitter::process(const float *const *channels, int channelCount, int frames)
+{
+    for (int i = 0; i < frames; ++i)
+    {
+        float peak = 0.0f;
+
+        for (int c = 0; c < channelCount; ++c)
+        {
+            peak = std::max(peak, std::abs(channels[c][i]));
+        }
+
+        const int bin = (int)((position % periodFrames) * resolution / periodFrames);
+
+        sums[bin] += peak * peak;
+        counts[bin]++;
+
+        position++;
+    }
+}
+
+void EnvelopeFitter::computeEnvelope()
+{
+    float maxAmplitude = 0.0f;
+
+    for (int i = 0; i < resolution; ++i)
+    {
+        envelope[i] = counts[i] > 0 ? std::sqrt(sums[i] / counts[i]) : 0.0f;
+        maxAmplitude = std::max(maxAmplitude, envelope[i]);
+    }
+
+    const double euler = std::exp(1.0);
+
+    for (int i = 0; i < resolution; ++i)
+    {
+        const float amplitude = maxAmplitude > 0.0f ? envelope[i] / maxAmplitude : 0.0f;
+
+        // inverse of the gain curve the plugin applies to the graph output
+        envelope[i] = std::log(1.0 + amplitude * (euler - 1.0));
+    }
+
+    // the graph loops, so it ends where it starts
+    envelope[resolution] = envelope[0];
+}
+
+int EnvelopeFitter::simplify(float tolerance)
+{
+    for (int i = 0; i <= resolution; ++i)
+    {
+        keep[i] = false;
+    }
+
+    keep[0] = true;
+    keep[resolution] = true;
+
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    stack[stackSize++] = resolution;
+
+    while (stackSize > 0)
+    {
+        const int end = stack[--stackSize];
+        const int start = stack[--stackSize];
+
+        const float y1 = envelope[start];
+        const float y2 = envelope[end];
+
+        float maxDistance = 0.0f;
+        int farthest = -1;
+
+        // vertical distance: x is the time axis, y is what the ear hears
+        for (int i = start + 1; i < end; ++i)
+        {
+            const float t = (float)(i - start) / (end - start);
+            const float distance = std::abs(envelope[i] - (y1 + (y2 - y1) * t));
+
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        if (farthest != -1 && maxDistance > tolerance)
+        {
+            keep[farthest] = true;
+
+            stack[stackSize++] = start;
+            stack[stackSize++] = farthest;
+            stack[stackSize++] = farthest;
+            stack[stackSize++] = end;
+        }
+    }
+
+    int vertexCount = 0;
+
+    for (int i = 0; i <= resolution; ++i)
+    {
+        if (keep[i])
+            vertexCount++;
+    }
+
+    return vertexCount;
+}
+
+float EnvelopeFitter::getSegmentError(int start, int end, float tension, int curveType)
+{
+    std::snprintf(segmentBuffer, sizeof(segmentBuffer), "%a,%a,%a,%d;%a,%a,%a,%d;",
+                  0.0f, envelope[start], tension, curveType,
+                  1.0f, envelope[end], 0.0f, curveType);
+
+    segmentGraph.rebuildFromString(segmentBuffer);
+
+    float error = 0.0f;
+
+    for (int i = start + 1; i < end; ++i)
+    {
+        const float difference = segmentGraph.getValueAt((float)(i - start) / (end - start)) - envelope[i];
+        error += difference * difference;
+    }
+
+    return error;
+}
+
+float EnvelopeFitter::fitTension(int start, int end, int curveType, float &error)
+{
+    // golden-section search; the error is unimodal in the tension for monotonic segments
+    const float ratio = 0.618034f;
+
+    float low = -maxTension;
+    float high = maxTension;
+
+    float a = high - ratio * (high - low);
+    float b = low + ratio * (high - low);
+    float errorA = getSegmentError(start, end, a, curveType);
+    float errorB = getSegmentError(start, end, b, curveType);
+
+    for (int i = 0; i < 24; ++i)
+    {
+        if (errorA < errorB)
+        {
+            high = b;
+            b = a;
+            errorB = errorA;
+            a = high - ratio * (high - low);
+            errorA = getSegmentError(start, end, a, curveType);
+        }
+        else
+        {
+            low = a;
+            a = b;
+            errorA = errorB;
+            b = low + ratio * (high - low);
+            errorB = getSegmentError(start, end, b, curveType);
+        }
+    }
+
+    const float tension = (low + high) / 2.0f;
+
+    error = getSegmentError(start, end, tension, curveType);
+
+    return tension;
+}
+
+const char *EnvelopeFitter::fit(float tolerance)
+{
+    computeEnvelope();
+
+    tolerance = std::max(tolerance, 0.0001f);
+
+    while (simplify(tolerance) > maxFittedVertices)
+    {
+        tolerance *= 1.5f;
+    }
+
+    int vertexCount = 0;
+
+    for (int i = 0; i <= resolution; ++i)
+    {
+        if (keep[i])
+            vertexIndices[vertexCount++] = i;
+    }
+
+    for (int i = 0; i < vertexCount - 1; ++i)
+    {
+        const int start = vertexIndices[i];
+        const int end = vertexIndices[i + 1];
+
+        // keep straight lines when curving doesn't help
+        vertexTensions[i] = 0.0f;
+        vertexCurveTypes[i] = straightCurveType;
+
+        if (end - start < 2 || envelope[start] == envelope[end])
+            continue;
+
+        float bestError = getSegmentError(start, end, 0.0f, straightCurveType);
+
+        for (int t = 0; t < fittedCurveTypeCount; ++t)
+        {
+            float error;
+            const float tension = fitTension(start, end, fittedCurveTypes[t], error);
+
+            if (error < bestError)
+            {
+                bestError = error;
+                vertexTensions[i] = tension;
+                vertexCurveTypes[i] = fittedCurveTypes[t];
+            }
+        }
+    }
+
+    vertexTensions[vertexCount - 1] = 0.0f;
+    vertexCurveTypes[vertexCount - 1] = straightCurveType;
+
+    int length = 0;
+
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const float x = (float)vertexIndices[i] / resolution;
+        const float y = envelope[vertexIndices[i]];
+
+        length += std::snprintf(serializationBuffer + length, sizeof(serializationBuffer) - length, "%a,%a,%a,%d;",
+                                x, y, vertexTensions[i], vertexCurveTypes[i]);
+    }
+
+    return serializationBuffer;
+}
+
+const char *EnvelopeFitter::fitFile(const char *path, double periodSeconds, float tolerance)
+{
+    WavReader reader;
+
+    if (!reader.open(path))
+        return NULL;
+
+    if (periodSeconds > 0.0)
+        reset((uint64_t)(periodSeconds * reader.getSampleRate() + 0.5));
+    else
+        reset(reader.getFrameCount());
+
+    float *channels[WavReader::maxChannels];
+
+    for (int c = 0; c < WavReader::maxChannels; ++c)
+    {
+        channels[c] = blocks[c];
+    }
+
+    int frames;
+
+    while ((frames = reader.read(channels, blockSize)) > 0)
+    {
+        process(channels, reader.getChannelCount(), frames);
+    }
+
+    return fit(tolerance);
+}
+}
@@ -0,0 +1,80 @@
+#include "GraphState.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstddef>
+
+namespace wolf
+{
+static const long curveTypeCount = 4;
+static const float maxTension = 100.0f;
+
+static bool parseFloat(const char *&c, float &value, char separator)
+{
+    char *end;
+    value = std::strtof(c, &end);
+
+    if (end == c || *end != separator || !std::isfinite(value))
+        return false;
+
+    c = end + 1;
+
+    return true;
+}
+
+static bool parseInteger(const char *&c, long &value, char separator)
+{
+    char *end;
+    value = std::strtol(c, &end, 10);
+
+    if (end == c || *end != separator)
+        return false;
+
+    c = end + 1;
+
+    return true;
+}
+
+bool validateGraphState(const char *state)
+{
+    if (state == NULL)
+        return false;
+
+    // bound the length first, so the parsing below can't run away
+    int length = 0;
+
+    while (state[length] != '\0')
+    {
+        if (++length > maxStateLength)
+            return false;
+    }
+
+    const char *c = state;
+
+    int vertexCount = 0;
+    float previousX = 0.0f;
+
+    while (*c != '\0')
+    {
+        if (vertexCount == maxStateVertices)
+            return false;
+
+        float x, y, tension;
+        long type;
+
+        if (!parseFloat(c, x, ',') || !parseFloat(c, y, ',') || !parseFloat(c, tension, ',') || !parseInteger(c, type, ';'))
+            return false;
+
+        if (x < previousX || x > 1.0f || y < 0.0f || y > 1.0f)
+            return false;
+
+        if (std::abs(tension) > maxTension || type < 0 || type >= curveTypeCount)
+            return false;
+
+        previousX = x;
+        vertexCount++;
+    }
+
+    return vertexCount >= 2;
+}
+}
@@ -0,0 +1,102 @@
+#include "LinearPhaseCrossover.hpp"
+
+#include <algorithm>
+
+namespace wolf
+{
+LinearPhaseCrossover::LinearPhaseCrossover() : bandCount(1),
+                                               delayPosition(0)
+{
+    for (int c = 0; c < 2; ++c)
+    {
+        delayLines[c].resize(getLatency(), 0.0f);
+    }
+}
+
+void LinearPhaseCrossover::setup(int bandCount, const float *frequencies, double sampleRate)
+{
+    bandCount = std::max(1, std::min(bandCount, (int)maxBands));
+
+    float previousFrequency = 0.0f;
+
+    for (int i = 0; i < bandCount - 1; ++i)
+    {
+        // keep the crossovers in order and below nyquist
+        const float frequency = std::min(std::max(frequencies[i], previousFrequency), (float)(sampleRate * 0.45));
+        previousFrequency = frequency;
+
+        Dsp::Params params;
+        params[0] = sampleRate;
+        params[1] = 4;
+        params[2] = frequency;
+
+        lowPasses[i].setParams(params);
+    }
+
+    if (bandCount != this->bandCount)
+    {
+        this->bandCount = bandCount;
+        reset();
+    }
+}
+
+void LinearPhaseCrossover::reset()
+{
+    for (int i = 0; i < maxBands - 1; ++i)
+    {
+        lowPasses[i].reset();
+    }
+
+    for (int c = 0; c < 2; ++c)
+    {
+        std::fill(delayLines[c].begin(), delayLines[c].end(), 0.0f);
+    }
+
+    delayPosition = 0;
+}
+
+void LinearPhaseCrossover::process(const float *inputL, const float *inputR, int frames, float *const *left, float *const *right)
+{
+    if (bandCount == 1)
+    {
+        std::copy(inputL, inputL + frames, left[0]);
+        std::copy(inputR, inputR + frames, right[0]);
+        return;
+    }
+
+    // the band under each crossover starts as the low passed input
+    for (int i = 0; i < bandCount - 1; ++i)
+    {
+        std::copy(inputL, inputL + frames, left[i]);
+        std::copy(inputR, inputR + frames, right[i]);
+
+        float *const channels[2] = {left[i], right[i]};
+        lowPasses[i].process(frames, channels);
+    }
+
+    const int top = bandCount - 1;
+    const int latency = delayLines[0].size();
+
+    for (int j = 0; j < frames; ++j)
+    {
+        left[top][j] = delayLines[0][delayPosition];
+        right[top][j] = delayLines[1][delayPosition];
+
+        delayLines[0][delayPosition] = inputL[j];
+        delayLines[1][delayPosition] = inputR[j];
+
+        if (++delayPosition == latency)
+            delayPosition = 0;
+    }
+
+    // from the top down, so the low pass below is still whole when it is subtracted
+    for (int i = top; i > 0; --i)
+    {
+        for (int j = 0; j < frames; ++j)
+        {
+            left[i][j] -= left[i - 1][j];
+            right[i][j] -= right[i - 1][j];
+        }
+    }
+}
+}
@@ -0,0 +1,88 @@
+#include "OutputSmoother.hpp"
+
+#include "DspFilters/Butterworth.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace wolf
+{
+OutputSmoother::OutputSmoother() : mode(smoothingOnePole),
+                                   frequency(0.0f),
+                                   riseTime(0.0f),
+                                   fallTime(0.0f),
+                                   sampleRate(0.0),
+                                   a(0.0f),
+                                   b(1.0f),
+                                   riseStep(1.0f),
+                                   fallStep(1.0f),
+                                   b0(1.0),
+                                   b1(0.0),
+                                   b2(0.0),
+                                   a1(0.0),
+                                   a2(0.0)
+{
+    reset(0.0f);
+}
+
+void OutputSmoother::setup(SmoothingMode mode, float frequency, float riseTime, float fallTime, double sampleRate)
+{
+    if (mode < 0 || mode >= smoothingModeCount)
+        mode = smoothingOnePole;
+
+    if (mode == this->mode && frequency == this->frequency && riseTime == this->riseTime && fallTime == this->fallTime && sampleRate == this->sampleRate)
+        return;
+
+    // carry on from the current output, whatever the previous mode was
+    const float output = this->mode == smoothingTwoPole ? z2 : z1;
+    const bool modeChanged = mode != this->mode;
+
+    this->mode = mode;
+    this->frequency = frequency;
+    this->riseTime = riseTime;
+    this->fallTime = fallTime;
+    this->sampleRate = sampleRate;
+
+    calculateCoefficients();
+
+    if (modeChanged)
+        reset(output);
+}
+
+void OutputSmoother::reset(float value)
+{
+    z1 = value;
+    z2 = value;
+
+    // steady state of the transposed direct form II for a constant input
+    s2 = value * (b2 - a2);
+    s1 = value * (b1 - a1) + s2;
+}
+
+void OutputSmoother::calculateCoefficients()
+{
+    if (sampleRate <= 0.0 || frequency <= 0.0f)
+        return;
+
+    // same as ParamSmooth
+    a = std::exp(-2.0f * (float)M_PI * frequency / (float)sampleRate);
+    b = 1.0f - a;
+
+    riseStep = riseTime > 0.0f ? (float)(1000.0 / (riseTime * sampleRate)) : 1.0f;
+    fallStep = fallTime > 0.0f ? (float)(1000.0 / (fallTime * sampleRate)) : 1.0f;
+
+    if (mode == smoothingButterworth)
+    {
+        Dsp::Butterworth::LowPass<2> design;
+        design.setup(2, sampleRate, std::min((double)frequency, sampleRate * 0.45));
+
+        const Dsp::Cascade::Stage &stage = design[0];
+
+        b0 = stage.m_b0;
+        b1 = stage.m_b1;
+        b2 = stage.m_b2;
+        a1 = stage.m_a1;
+        a2 = stage.m_a2;
+    }
+}
+}
@@ -0,0 +1,190 @@
+#include "ShapeCache.hpp"
+
+#include <cmath>
+
+namespace wolf
+{
+SharedShape::SharedShape(bool cached) : key(0),
+                                        refCount(-1),
+                                        cached(cached),
+                                        nextGarbage(NULL)
+{
+}
+
+const ShapeTable &SharedShape::getTable() const
+{
+    return table;
+}
+
+ShapeCache::ShapeCache() : garbage(NULL)
+{
+    for (int i = 0; i < slotCount; ++i)
+    {
+        slots[i].store(NULL);
+    }
+}
+
+ShapeCache::~ShapeCache()
+{
+    collectGarbage();
+
+    for (int i = 0; i < slotCount; ++i)
+    {
+        delete slots[i].load();
+    }
+}
+
+ShapeCache &ShapeCache::getInstance()
+{
+    static ShapeCache instance;
+
+    return instance;
+}
+
+uint64_t ShapeCache::hashGraph(const char *serializedGraph)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const char *c = serializedGraph; *c != '\0'; ++c)
+    {
+        hash ^= (unsigned char)*c;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+float ShapeCache::quantizeWarpAmount(float warpAmount)
+{
+    return std::round(warpAmount * 1024.0f) / 1024.0f;
+}
+
+uint64_t ShapeCache::makeKey(uint64_t graphHash, WarpType warpType, float warpAmount)
+{
+    const uint64_t warpSteps = (uint64_t)std::round(warpAmount * 1024.0f);
+
+    uint64_t key = graphHash ^ (((uint64_t)warpType << 32 | warpSteps) * 0x9E3779B97F4A7C15ULL);
+
+    // the empty hash is used by fresh entries
+    return key == 0 ? 1 : key;
+}
+
+bool ShapeCache::tryRetain(const SharedShape *shape)
+{
+    int count = shape->refCount.load(std::memory_order_relaxed);
+
+    do
+    {
+        if (count < 0)
+            return false;
+    } while (!shape->refCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+    return true;
+}
+
+const SharedShape *ShapeCache::find(uint64_t key)
+{
+    const int first = (int)(key % slotCount);
+
+    for (int i = 0; i < probeCount; ++i)
+    {
+        const SharedShape *shape = slots[(first + i) % slotCount].load(std::memory_order_acquire);
+
+        if (shape == NULL || shape->key.load(std::memory_order_relaxed) != key)
+            continue;
+
+        if (!tryRetain(shape))
+            continue;
+
+        // the entry might have been recycled before we got our reference
+        if (shape->key.load(std::memory_order_relaxed) == key)
+            return shape;
+
+        release(shape);
+    }
+
+    return NULL;
+}
+
+const SharedShape *ShapeCache::acquire(uint64_t key, Graph &graph, WarpType warpType, float warpAmount)
+{
+    collectGarbage();
+
+    const std::lock_guard<std::mutex> lock(writerMutex);
+
+    const SharedShape *found = find(key);
+
+    if (found != NULL)
+        return found;
+
+    warpAmount = quantizeWarpAmount(warpAmount);
+
+    const int first = (int)(key % slotCount);
+
+    for (int i = 0; i < probeCount; ++i)
+    {
+        std::atomic<SharedShape *> &slot = slots[(first + i) % slotCount];
+        SharedShape *shape = slot.load(std::memory_order_relaxed);
+
+        if (shape == NULL)
+        {
+            shape = new SharedShape(true);
+            shape->table.bake(graph, warpType, warpAmount);
+            shape->key.store(key, std::memory_order_relaxed);
+            shape->refCount.store(1, std::memory_order_release);
+
+            slot.store(shape, std::memory_order_release);
+
+            return shape;
+        }
+
+        int unused = 0;
+
+        if (shape->refCount.compare_exchange_strong(unused, -1, std::memory_order_acquire))
+        {
+            shape->table.bake(graph, warpType, warpAmount);
+            shape->key.store(key, std::memory_order_relaxed);
+            shape->refCount.store(1, std::memory_order_release);
+
+            return shape;
+        }
+    }
+
+    // every slot this key can use is taken by a live shape
+    SharedShape *shape = new SharedShape(false);
+    shape->table.bake(graph, warpType, warpAmount);
+    shape->key.store(key, std::memory_order_relaxed);
+    shape->refCount.store(1, std::memory_order_release);
+
+    return shape;
+}
+
+void ShapeCache::release(const SharedShape *shape)
+{
+    if (shape == NULL)
+        return;
+
+    if (shape->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1 || shape->cached)
+        return;
+
+    SharedShape *dead = const_cast<SharedShape *>(shape);
+    dead->nextGarbage = garbage.load(std::memory_order_relaxed);
+
+    while (!garbage.compare_exchange_weak(dead->nextGarbage, dead, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+void ShapeCache::collectGarbage()
+{
+    SharedShape *shape = garbage.exchange(NULL, std::memory_order_acquire);
+
+    while (shape != NULL)
+    {
+        SharedShape *next = shape->nextGarbage;
+        delete shape;
+        shape = next;
+    }
+}
+}
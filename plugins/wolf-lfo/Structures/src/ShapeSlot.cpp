@@ -0,0 +1,227 @@
+#include "ShapeSlot.hpp"
+#include "GraphState.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace wolf
+{
+ShapeSlot::ShapeSlot() : mustCopyGraph(false),
+                         shape(&privateShape),
+                         sharedShape(NULL),
+                         tempSharedShape(NULL),
+                         unwarpedShape(&privateUnwarpedShape),
+                         unwarpedSharedShape(NULL),
+                         tempUnwarpedSharedShape(NULL),
+                         warpedSegment(0),
+                         graphHash(0),
+                         tempGraphHash(0)
+{
+    privateShape.bake(graph, (WarpType)0, 0.0f);
+    privateUnwarpedShape.bake(graph, (WarpType)0, 0.0f);
+
+    storeUnwarpedVertices();
+    measureSegments(graph, privateUnwarpedShape, segmentStatistics);
+}
+
+ShapeSlot::~ShapeSlot()
+{
+    ShapeCache &shapeCache = ShapeCache::getInstance();
+
+    shapeCache.release(sharedShape);
+    shapeCache.release(tempSharedShape);
+    shapeCache.release(unwarpedSharedShape);
+    shapeCache.release(tempUnwarpedSharedShape);
+}
+
+bool ShapeSlot::setGraph(const char *serializedGraph, WarpType warpType, float warpAmount)
+{
+    if (!validateGraphState(serializedGraph))
+        return false;
+
+    ShapeCache &shapeCache = ShapeCache::getInstance();
+
+    tempGraph.rebuildFromString(serializedGraph);
+
+    //the previous graph might not have reached the audio thread yet
+    shapeCache.release(tempSharedShape);
+    shapeCache.release(tempUnwarpedSharedShape);
+
+    tempGraphHash = ShapeCache::hashGraph(serializedGraph);
+    tempSharedShape = shapeCache.acquire(ShapeCache::makeKey(tempGraphHash, warpType, warpAmount), tempGraph, warpType, warpAmount);
+    tempUnwarpedSharedShape = shapeCache.acquire(ShapeCache::makeKey(tempGraphHash, (WarpType)0, 0.0f), tempGraph, (WarpType)0, 0.0f);
+
+    measureSegments(tempGraph, tempUnwarpedSharedShape->getTable(), tempSegmentStatistics);
+
+    mustCopyGraph = true;
+
+    return true;
+}
+
+bool ShapeSlot::hasPendingGraph() const
+{
+    return mustCopyGraph;
+}
+
+void ShapeSlot::commitPendingGraph()
+{
+    graph = tempGraph;
+
+    for (int i = 0; i < graph.getVertexCount(); ++i)
+    {
+        graph.getVertexAtIndex(i)->setGraphPtr(&graph);
+    }
+
+    ShapeCache &shapeCache = ShapeCache::getInstance();
+
+    shapeCache.release(sharedShape);
+    shapeCache.release(unwarpedSharedShape);
+
+    sharedShape = tempSharedShape;
+    tempSharedShape = NULL;
+    unwarpedSharedShape = tempUnwarpedSharedShape;
+    tempUnwarpedSharedShape = NULL;
+    graphHash = tempGraphHash;
+
+    shape = &sharedShape->getTable();
+    unwarpedShape = &unwarpedSharedShape->getTable();
+
+    storeUnwarpedVertices();
+
+    std::copy(tempSegmentStatistics, tempSegmentStatistics + maxVertices, segmentStatistics);
+
+    mustCopyGraph = false;
+}
+
+void ShapeSlot::storeUnwarpedVertices()
+{
+    graph.setHorizontalWarpType((WarpType)0);
+    graph.setHorizontalWarpAmount(0.0f);
+
+    for (int i = 0; i < graph.getVertexCount(); ++i)
+    {
+        unwarpedX[i] = graph.getVertexAtIndex(i)->getX();
+    }
+
+    warpedSegment = 0;
+}
+
+void ShapeSlot::measureSegments(Graph &graph, const ShapeTable &unwarpedTable, ShapeStatistics *statistics)
+{
+    graph.setHorizontalWarpType((WarpType)0);
+    graph.setHorizontalWarpAmount(0.0f);
+
+    // without segments, the first entry holds the whole table
+    if (graph.getVertexCount() < 2)
+        statistics[0] = unwarpedTable.getStatistics(0.0f, 1.0f);
+
+    for (int i = 0; i < graph.getVertexCount() - 1; ++i)
+    {
+        statistics[i] = unwarpedTable.getStatistics(graph.getVertexAtIndex(i)->getX(), graph.getVertexAtIndex(i + 1)->getX());
+    }
+}
+
+ShapeStatistics ShapeSlot::getStatistics(WarpType warpType, float warpAmount)
+{
+    const int segmentCount = graph.getVertexCount() - 1;
+
+    if (segmentCount < 1)
+        return segmentStatistics[0];
+
+    graph.setHorizontalWarpType(warpType);
+    graph.setHorizontalWarpAmount(warpAmount);
+
+    ShapeStatistics total = segmentStatistics[0];
+
+    double width = 0.0;
+    double integral = 0.0;
+    double squares = 0.0;
+    double gain = 0.0;
+
+    float x1 = graph.getVertexAtIndex(0)->getX();
+
+    for (int i = 0; i < segmentCount; ++i)
+    {
+        const ShapeStatistics &segment = segmentStatistics[i];
+        const float x2 = graph.getVertexAtIndex(i + 1)->getX();
+        const double segmentWidth = std::max(0.0f, x2 - x1);
+
+        width += segmentWidth;
+        integral += segmentWidth * segment.mean;
+        squares += segmentWidth * segment.rms * segment.rms;
+        gain += segmentWidth * segment.meanGain;
+
+        total.min = std::min(total.min, segment.min);
+        total.max = std::max(total.max, segment.max);
+
+        x1 = x2;
+    }
+
+    if (width <= 0.0)
+        return total;
+
+    total.mean = integral / width;
+    total.rms = std::sqrt(squares / width);
+    total.integral = integral;
+    total.meanGain = gain / width;
+
+    return total;
+}
+
+void ShapeSlot::setWarp(WarpType warpType, float warpAmount)
+{
+    warpAmount = ShapeCache::quantizeWarpAmount(warpAmount);
+
+    if (warpType == shape->getWarpType() && warpAmount == shape->getWarpAmount())
+        return;
+
+    ShapeCache &shapeCache = ShapeCache::getInstance();
+
+    const SharedShape *found = graphHash != 0 ? shapeCache.find(ShapeCache::makeKey(graphHash, warpType, warpAmount)) : NULL;
+
+    shapeCache.release(sharedShape);
+    sharedShape = found;
+
+    if (found != NULL)
+    {
+        shape = &found->getTable();
+        return;
+    }
+
+    //no instance has baked this shape yet
+    privateShape.bake(graph, warpType, warpAmount);
+    shape = &privateShape;
+}
+
+float ShapeSlot::getWarpedValueAt(float x, WarpType warpType, float warpAmount)
+{
+    const int lastSegment = graph.getVertexCount() - 2;
+
+    if (lastSegment < 0)
+        return unwarpedShape->getValueAt(x);
+
+    graph.setHorizontalWarpType(warpType);
+    graph.setHorizontalWarpAmount(warpAmount);
+
+    // the warp keeps the vertices in order, so walk from the last segment
+    int segment = warpedSegment;
+
+    while (segment > 0 && x < graph.getVertexAtIndex(segment)->getX())
+        --segment;
+
+    while (segment < lastSegment && x > graph.getVertexAtIndex(segment + 1)->getX())
+        ++segment;
+
+    warpedSegment = segment;
+
+    const float x1 = graph.getVertexAtIndex(segment)->getX();
+    const float x2 = graph.getVertexAtIndex(segment + 1)->getX();
+
+    if (x2 <= x1)
+        return unwarpedShape->getValueAt(unwarpedX[segment + 1]);
+
+    const float position = (x - x1) / (x2 - x1);
+
+    return unwarpedShape->getValueAt(unwarpedX[segment] + (unwarpedX[segment + 1] - unwarpedX[segment]) * position);
+}
+}
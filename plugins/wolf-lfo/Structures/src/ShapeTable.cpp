@@ -0,0 +1,111 @@
+#include "ShapeTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace wolf
+{
+ShapeTable::ShapeTable() : warpType((WarpType)0),
+                           warpAmount(0.0f)
+{
+    for (int i = 0; i <= size; ++i)
+    {
+        values[i] = 0.0f;
+    }
+}
+
+void ShapeTable::bake(Graph &graph, WarpType warpType, float warpAmount)
+{
+    graph.setHorizontalWarpType(warpType);
+    graph.setHorizontalWarpAmount(warpAmount);
+
+    for (int i = 0; i <= size; ++i)
+    {
+        values[i] = graph.getValueAt((float)i / size);
+    }
+
+    this->warpType = warpType;
+    this->warpAmount = warpAmount;
+}
+
+WarpType ShapeTable::getWarpType() const
+{
+    return warpType;
+}
+
+float ShapeTable::getWarpAmount() const
+{
+    return warpAmount;
+}
+
+double ShapeTable::getValueAtPosition(double position) const
+{
+    const int index = std::min((int)position, size - 1);
+    const double frac = position - index;
+
+    return values[index] + (values[index + 1] - values[index]) * frac;
+}
+
+ShapeStatistics ShapeTable::getStatistics(float x1, float x2) const
+{
+    const double euler = std::exp(1.0);
+
+    const double start = std::max(0.0, std::min((double)size, (double)x1 * size));
+    const double end = std::max(start, std::min((double)size, (double)x2 * size));
+
+    double a = getValueAtPosition(start);
+    double expA = std::exp(a);
+
+    double integral = 0.0;
+    double squares = 0.0;
+    double gain = 0.0;
+
+    ShapeStatistics statistics;
+    statistics.min = a;
+    statistics.max = a;
+
+    // split at every entry, the pieces at both ends may be partial
+    for (double position = start; position < end;)
+    {
+        const double next = std::min(end, std::floor(position) + 1.0);
+        const double width = next - position;
+
+        const double b = getValueAtPosition(next);
+        const double expB = std::exp(b);
+
+        integral += width * (a + b) * 0.5;
+        squares += width * (a * a + a * b + b * b) / 3.0;
+
+        if (std::abs(b - a) > 1e-9)
+            gain += width * (expB - expA) / (b - a);
+        else
+            gain += width * expA;
+
+        statistics.min = std::min(statistics.min, (float)b);
+        statistics.max = std::max(statistics.max, (float)b);
+
+        position = next;
+        a = b;
+        expA = expB;
+    }
+
+    const double width = end - start;
+
+    if (width <= 0.0)
+    {
+        statistics.mean = a;
+        statistics.rms = std::abs(a);
+        statistics.integral = 0.0f;
+        statistics.meanGain = (expA - 1.0) / (euler - 1.0);
+
+        return statistics;
+    }
+
+    statistics.mean = integral / width;
+    statistics.rms = std::sqrt(squares / width);
+    statistics.integral = integral / size;
+    statistics.meanGain = (gain / width - 1.0) / (euler - 1.0);
+
+    return statistics;
+}
+}
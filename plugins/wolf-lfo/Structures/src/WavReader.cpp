@@ -0,0 +1,222 @@
+#include "WavReader.hpp"
+
+#include <cstring>
+
+namespace wolf
+{
+static const int formatPCM = 1;
+static const int formatFloat = 3;
+static const int formatExtensible = 0xFFFE;
+
+static uint32_t readLE(const unsigned char *bytes, int count)
+{
+    uint32_t value = 0;
+
+    for (int i = count - 1; i >= 0; --i)
+    {
+        value = value << 8 | bytes[i];
+    }
+
+    return value;
+}
+
+WavReader::WavReader() : file(NULL),
+                         channelCount(0),
+                         sampleRate(0.0),
+                         bytesPerSample(0),
+                         isFloat(false),
+                         frameCount(0),
+                         framesLeft(0)
+{
+}
+
+WavReader::~WavReader()
+{
+    close();
+}
+
+bool WavReader::open(const char *path)
+{
+    close();
+
+    file = std::fopen(path, "rb");
+
+    if (file == NULL)
+        return false;
+
+    if (!readHeader())
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void WavReader::close()
+{
+    if (file != NULL)
+        std::fclose(file);
+
+    file = NULL;
+    frameCount = 0;
+    framesLeft = 0;
+}
+
+bool WavReader::readHeader()
+{
+    unsigned char header[12];
+
+    if (std::fread(header, 1, 12, file) != 12 || std::memcmp(header, "RIFF", 4) != 0 || std::memcmp(header + 8, "WAVE", 4) != 0)
+        return false;
+
+    bool hasFormat = false;
+
+    // walk the chunks up to the samples, skipping the ones we don't use
+    for (;;)
+    {
+        unsigned char chunk[8];
+
+        if (std::fread(chunk, 1, 8, file) != 8)
+            return false;
+
+        const uint32_t chunkSize = readLE(chunk + 4, 4);
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0)
+        {
+            unsigned char format[40];
+
+            if (chunkSize < 16 || chunkSize > sizeof(format) || std::fread(format, 1, chunkSize, file) != chunkSize)
+                return false;
+
+            int formatTag = readLE(format, 2);
+
+            if (formatTag == formatExtensible && chunkSize >= 26)
+                formatTag = readLE(format + 24, 2);
+
+            channelCount = readLE(format + 2, 2);
+            sampleRate = readLE(format + 4, 4);
+            bytesPerSample = readLE(format + 14, 2) / 8;
+            isFloat = formatTag == formatFloat;
+
+            if (formatTag != formatPCM && formatTag != formatFloat)
+                return false;
+
+            if (channelCount < 1 || channelCount > maxChannels || sampleRate <= 0.0)
+                return false;
+
+            if (isFloat ? bytesPerSample != 4 && bytesPerSample != 8 : bytesPerSample < 1 || bytesPerSample > 4)
+                return false;
+
+            // chunks are padded to an even size
+            if ((chunkSize & 1) && std::fseek(file, 1, SEEK_CUR) != 0)
+                return false;
+
+            hasFormat = true;
+        }
+        else if (std::memcmp(chunk, "data", 4) == 0)
+        {
+            if (!hasFormat)
+                return false;
+
+            frameCount = chunkSize / (channelCount * bytesPerSample);
+            framesLeft = frameCount;
+
+            return true;
+        }
+        else if (std::fseek(file, chunkSize + (chunkSize & 1), SEEK_CUR) != 0)
+        {
+            return false;
+        }
+    }
+}
+
+float WavReader::decodeSample(const unsigned char *bytes) const
+{
+    if (isFloat)
+    {
+        if (bytesPerSample == 4)
+        {
+            float value;
+            const uint32_t bits = readLE(bytes, 4);
+            std::memcpy(&value, &bits, 4);
+
+            return value;
+        }
+
+        double value;
+        const uint64_t bits = (uint64_t)readLE(bytes + 4, 4) << 32 | readLE(bytes, 4);
+        std::memcpy(&value, &bits, 8);
+
+        return (float)value;
+    }
+
+    // 8-bit samples are unsigned, the wider ones are signed
+    if (bytesPerSample == 1)
+        return (bytes[0] - 128) / 128.0f;
+
+    const int shift = 32 - 8 * bytesPerSample;
+    const int32_t value = (int32_t)(readLE(bytes, bytesPerSample) << shift);
+
+    return value / 2147483648.0f;
+}
+
+int WavReader::read(float *const *channels, int maxFrames)
+{
+    if (file == NULL)
+        return 0;
+
+    const int frameBytes = channelCount * bytesPerSample;
+    const int bufferFrames = (int)sizeof(buffer) / frameBytes;
+
+    int framesRead = 0;
+
+    while (framesRead < maxFrames && framesLeft > 0)
+    {
+        int frames = maxFrames - framesRead;
+
+        if (frames > bufferFrames)
+            frames = bufferFrames;
+
+        if ((uint64_t)frames > framesLeft)
+            frames = (int)framesLeft;
+
+        frames = (int)std::fread(buffer, frameBytes, frames, file);
+
+        if (frames == 0)
+        {
+            // the file is shorter than its header says
+            framesLeft = 0;
+            break;
+        }
+
+        for (int i = 0; i < frames; ++i)
+        {
+            for (int c = 0; c < channelCount; ++c)
+            {
+                channels[c][framesRead + i] = decodeSample(buffer + i * frameBytes + c * bytesPerSample);
+            }
+        }
+
+        framesRead += frames;
+        framesLeft -= frames;
+    }
+
+    return framesRead;
+}
+
+int WavReader::getChannelCount() const
+{
+    return channelCount;
+}
+
+double WavReader::getSampleRate() const
+{
+    return sampleRate;
+}
+
+uint64_t WavReader::getFrameCount() const
+{
+    return frameCount;
+}
+}
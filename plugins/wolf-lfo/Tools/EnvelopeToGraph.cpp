@@ -0,0 +1,72 @@
+/*
+ * Turns the amplitude envelope of a WAV file into a graph, for offline rendering
+ * or for pasting into a session. Uses the same fitter as the editor's import action.
+ * Build with "make envelope-to-graph", then run
+ * bin/wolf-lfo-envelope-to-graph file.wav [--bpm BPM [--beats BEATS]] [--seconds S] [--tolerance T]
+ *
+ * With --bpm, the file is folded onto one bar (4 beats unless --beats is given).
+ * With --seconds, it is folded onto that length. Without either, the whole file
+ * becomes the graph. The graph is printed on stdout.
+ */
+
+#include "EnvelopeFitter.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// large enough that it doesn't belong on the stack
+static wolf::EnvelopeFitter fitter;
+
+static int usage(const char *program)
+{
+    std::fprintf(stderr, "usage: %s file.wav [--bpm BPM [--beats BEATS]] [--seconds S] [--tolerance T]\n", program);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+        return usage(argv[0]);
+
+    double bpm = 0.0;
+    double beats = 4.0;
+    double seconds = 0.0;
+    float tolerance = 0.02f;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        if (i + 1 >= argc)
+            return usage(argv[0]);
+
+        const double value = std::atof(argv[i + 1]);
+
+        if (std::strcmp(argv[i], "--bpm") == 0)
+            bpm = value;
+        else if (std::strcmp(argv[i], "--beats") == 0)
+            beats = value;
+        else if (std::strcmp(argv[i], "--seconds") == 0)
+            seconds = value;
+        else if (std::strcmp(argv[i], "--tolerance") == 0)
+            tolerance = (float)value;
+        else
+            return usage(argv[0]);
+
+        ++i;
+    }
+
+    if (bpm > 0.0)
+        seconds = beats * 60.0 / bpm;
+
+    const char *graph = fitter.fitFile(argv[1], seconds, tolerance);
+
+    if (graph == NULL)
+    {
+        std::fprintf(stderr, "%s: can't read %s as a WAV file\n", argv[0], argv[1]);
+        return 1;
+    }
+
+    std::printf("%s\n", graph);
+
+    return 0;
+}
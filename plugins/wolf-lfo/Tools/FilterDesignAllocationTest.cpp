@@ -0,0 +1,190 @@
+/*
+ * Checks that filter design is real-time safe: changing the parameters of
+ * a filter must not allocate or throw. Run with "make design-alloc-test".
+ * Exits with a non-zero status on the first design that fails.
+ */
+
+#include "DspFilters/Dsp.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <new>
+
+static bool countAllocations = false;
+static int allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+    if (countAllocations)
+        ++allocationCount;
+
+    void* memory = std::malloc(size == 0 ? 1 : size);
+
+    if (memory == NULL)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+static int failures = 0;
+
+static void report(const char* name, int allocations, const char* error)
+{
+    if (error != NULL)
+    {
+        std::printf("FAIL %-28s threw: %s\n", name, error);
+        ++failures;
+    }
+    else if (allocations != 0)
+    {
+        std::printf("FAIL %-28s %d allocations\n", name, allocations);
+        ++failures;
+    }
+    else
+    {
+        std::printf("ok   %s\n", name);
+    }
+}
+
+// Sweeps the frequency (parameter 2) and the order (parameter 1) of the
+// filter, the way an automated parameter would.
+template <class FilterClass>
+static void checkDesign(const char* name, const double* values, int valueCount)
+{
+    // static, so the test itself never goes through the replaced allocator
+    static FilterClass filter;
+    Dsp::Params params;
+
+    for (int i = 0; i < valueCount; ++i)
+    {
+        params[i] = values[i];
+    }
+
+    // the first design may fill the process-wide cache
+    filter.setParams(params);
+
+    Dsp::PoleZeroPair pairs[32];
+    const char* error = NULL;
+
+    countAllocations = true;
+    allocationCount = 0;
+
+    try
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            params[1] = 1 + (i / 10) % 8;
+            params[2] = 40.0 + i * 19.0;
+
+            filter.setParams(params);
+            filter.getPoleZeros(pairs, 32);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+    catch (...)
+    {
+        error = "unknown exception";
+    }
+
+    countAllocations = false;
+
+    report(name, allocationCount, error);
+}
+
+// The raw filters report whether the design converged.
+template <class FilterClass>
+static void checkSetup(const char* name)
+{
+    static FilterClass filter;
+    const char* error = NULL;
+    bool converged = true;
+
+    countAllocations = true;
+    allocationCount = 0;
+
+    try
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            converged &= filter.setup(1 + (i / 10) % 8, 48000.0, 40.0 + i * 19.0);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+    catch (...)
+    {
+        error = "unknown exception";
+    }
+
+    countAllocations = false;
+
+    if (error == NULL && !converged)
+        error = "setup() reported a design that did not converge";
+
+    report(name, allocationCount, error);
+}
+
+int main()
+{
+    using namespace Dsp;
+
+    const double lowPass[] = { 48000.0, 4.0, 1000.0 };
+    const double bandPass[] = { 48000.0, 4.0, 1000.0, 500.0 };
+    const double shelf[] = { 48000.0, 4.0, 1000.0, -6.0 };
+    const double chebyshev[] = { 48000.0, 4.0, 1000.0, 1.0 };
+    const double elliptic[] = { 48000.0, 4.0, 1000.0, 1.0, 1.0 };
+
+    checkDesign<FilterDesign<Butterworth::Design::LowPass<8>, 2> >("Butterworth low pass", lowPass, 3);
+    checkDesign<FilterDesign<Butterworth::Design::BandPass<8>, 2> >("Butterworth band pass", bandPass, 4);
+    checkDesign<FilterDesign<Bessel::Design::LowPass<8>, 2> >("Bessel low pass", lowPass, 3);
+    checkDesign<FilterDesign<Bessel::Design::BandStop<8>, 2> >("Bessel band stop", bandPass, 4);
+    checkDesign<FilterDesign<Bessel::Design::LowShelf<8>, 2> >("Bessel low shelf", shelf, 4);
+    checkDesign<FilterDesign<Legendre::Design::LowPass<8>, 2> >("Legendre low pass", lowPass, 3);
+    checkDesign<FilterDesign<Legendre::Design::BandPass<8>, 2> >("Legendre band pass", bandPass, 4);
+    checkDesign<FilterDesign<ChebyshevI::Design::LowPass<8>, 2> >("Chebyshev I low pass", chebyshev, 4);
+    checkDesign<FilterDesign<Elliptic::Design::LowPass<8>, 2> >("Elliptic low pass", elliptic, 5);
+    checkDesign<CachedFilterDesign<Bessel::Design::LowPass<8>, 2> >("Cached Bessel low pass", lowPass, 3);
+    checkDesign<CachedFilterDesign<Legendre::Design::HighPass<8>, 2> >("Cached Legendre high pass", lowPass, 3);
+
+    checkSetup<Bessel::LowPass<8> >("Bessel::LowPass::setup");
+    checkSetup<Legendre::HighPass<8> >("Legendre::HighPass::setup");
+
+    if (failures != 0)
+    {
+        std::printf("%d designs are not real-time safe\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+/*
+ * Writes Libs/DSPFilters/source/PrototypeTables.cpp.
+ * Run "make prototype-tables" after changing the prototype designs.
+ *
+ * Built with DSPFILTERS_NO_PROTOTYPE_TABLES so the prototypes come from
+ * the run time designs rather than from the tables being generated.
+ */
+
+#include "DspFilters/Dsp.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static const int orders[] = { 2, 4, 8 };
+static const int orderCount = sizeof(orders) / sizeof(orders[0]);
+
+// the elliptic grid, which includes the default ripple and rolloff
+static const char* const ellipticRipples[] = { "0.01", "0.1", "0.5", "1", "3" };
+static const int ellipticRippleCount = sizeof(ellipticRipples) / sizeof(ellipticRipples[0]);
+static const int ellipticRolloffMin = -4;
+static const int ellipticRolloffMax = 4;
+
+static void printLine(const char* line)
+{
+    std::printf("%s\r\n", line);
+}
+
+static void printTable(const char* name, const Dsp::LayoutBase& layout)
+{
+    std::printf("const double %s[] =\r\n{\r\n", name);
+
+    for (int i = 0; i < (layout.getNumPoles() + 1) / 2; ++i)
+    {
+        const Dsp::complex_t pole = layout[i].poles.first;
+        std::printf("  %.17g, %.17g,\r\n", pole.real(), pole.imag());
+    }
+
+    printLine("};");
+    printLine("");
+}
+
+// One order of the elliptic grid: for each ripple and then each rolloff,
+// the first pole of each conjugate pair and the imaginary part of its zero
+static void printEllipticTable(int order)
+{
+    std::printf("const double elliptic%d[] =\r\n{\r\n", order);
+
+    for (int r = 0; r < ellipticRippleCount; ++r)
+    {
+        for (int rolloff = ellipticRolloffMin; rolloff <= ellipticRolloffMax; ++rolloff)
+        {
+            Dsp::Layout<8> storage;
+            Dsp::Elliptic::AnalogLowPass layout;
+            layout.setStorage(storage);
+            layout.design(order, std::atof(ellipticRipples[r]), rolloff);
+
+            if (layout.getNumPoles() != order)
+            {
+                std::fprintf(stderr, "elliptic order %d, ripple %s, rolloff %d has %d poles\n",
+                             order, ellipticRipples[r], rolloff, layout.getNumPoles());
+                std::exit(1);
+            }
+
+            std::printf("  // %s dB, rolloff %d\r\n", ellipticRipples[r], rolloff);
+
+            for (int i = 0; i < order / 2; ++i)
+            {
+                const Dsp::complex_t pole = layout[i].poles.first;
+                const Dsp::complex_t zero = layout[i].zeros.first;
+                std::printf("  %.17g, %.17g, %.17g,\r\n", pole.real(), pole.imag(), zero.imag());
+            }
+        }
+    }
+
+    printLine("};");
+    printLine("");
+}
+
+int main()
+{
+    std::FILE* header = std::fopen("Libs/DSPFilters/include/DspFilters/PrototypeTables.h", "rb");
+
+    // same license block as the rest of the library
+    if (header != NULL)
+    {
+        char line[256];
+        while (std::fgets(line, sizeof(line), header) != NULL)
+        {
+            std::fputs(line, stdout);
+            if (std::strncmp(line, "*****", 5) == 0)
+                break;
+        }
+        std::fclose(header);
+        printLine("");
+    }
+
+    printLine("// Generated by Tools/GeneratePrototypeTables.cpp, do not edit.");
+    printLine("");
+    printLine("#include \"DspFilters/Common.h\"");
+    printLine("#include \"DspFilters/PrototypeTables.h\"");
+    printLine("");
+    printLine("namespace Dsp {");
+    printLine("");
+    printLine("namespace {");
+    printLine("");
+    printLine("// First pole of each conjugate pair, real and imaginary parts.");
+    printLine("// All zeros are at infinity.");
+    printLine("");
+
+    char name[64];
+
+    for (int i = 0; i < orderCount; ++i)
+    {
+        Dsp::Layout<8> storage;
+        Dsp::Butterworth::AnalogLowPass layout;
+        layout.setStorage(storage);
+        layout.design(orders[i]);
+        std::snprintf(name, sizeof(name), "butterworth%d", orders[i]);
+        printTable(name, layout);
+    }
+
+    for (int i = 0; i < orderCount; ++i)
+    {
+        Dsp::Bessel::Workspace<8> workspace;
+        Dsp::Layout<8> storage;
+        Dsp::Bessel::AnalogLowPass layout;
+        layout.setStorage(storage);
+        layout.design(orders[i], &workspace);
+        std::snprintf(name, sizeof(name), "bessel%d", orders[i]);
+        printTable(name, layout);
+    }
+
+    for (int i = 0; i < orderCount; ++i)
+    {
+        Dsp::Legendre::Workspace<8> workspace;
+        Dsp::Layout<8> storage;
+        Dsp::Legendre::AnalogLowPass layout;
+        layout.setStorage(storage);
+        layout.design(orders[i], &workspace);
+        std::snprintf(name, sizeof(name), "legendre%d", orders[i]);
+        printTable(name, layout);
+    }
+
+    printLine("// Elliptic prototypes for each ripple in ellipticRipples and each whole");
+    printLine("// rolloff from ellipticRolloffMin to ellipticRolloffMax. Every entry");
+    printLine("// has the first pole of each conjugate pair, real and imaginary parts,");
+    printLine("// and the imaginary part of its zero.");
+    printLine("");
+
+    std::printf("const double ellipticRipples[] = { ");
+    for (int r = 0; r < ellipticRippleCount; ++r)
+        std::printf(r == 0 ? "%s" : ", %s", ellipticRipples[r]);
+    printLine(" };");
+    std::printf("const int ellipticRolloffMin = %d;\r\n", ellipticRolloffMin);
+    std::printf("const int ellipticRolloffMax = %d;\r\n", ellipticRolloffMax);
+    printLine("");
+
+    for (int i = 0; i < orderCount; ++i)
+        printEllipticTable(orders[i]);
+
+    printLine("struct PrototypeTable");
+    printLine("{");
+    printLine("  PrototypeFamily family;");
+    printLine("  int numPoles;");
+    printLine("  const double* poles;");
+    printLine("};");
+    printLine("");
+    printLine("const PrototypeTable tables[] =");
+    printLine("{");
+
+    const char* families[] = { "Butterworth", "Bessel", "Legendre" };
+    const char* prefixes[] = { "butterworth", "bessel", "legendre" };
+
+    for (int f = 0; f < 3; ++f)
+        for (int i = 0; i < orderCount; ++i)
+            std::printf("  { prototype%s, %d, %s%d },\r\n", families[f], orders[i], prefixes[f], orders[i]);
+
+    printLine("};");
+    printLine("");
+    printLine("struct EllipticTable");
+    printLine("{");
+    printLine("  int numPoles;");
+    printLine("  const double* prototypes;");
+    printLine("};");
+    printLine("");
+    printLine("const EllipticTable ellipticTables[] =");
+    printLine("{");
+
+    for (int i = 0; i < orderCount; ++i)
+        std::printf("  { %d, elliptic%d },\r\n", orders[i], orders[i]);
+
+    printLine("};");
+    printLine("");
+    printLine("}");
+    printLine("");
+    printLine("bool loadPrototypeTable (PrototypeFamily family,");
+    printLine("                         int numPoles,");
+    printLine("                         LayoutBase& layout)");
+    printLine("{");
+    printLine("  for (size_t i = 0; i < sizeof (tables) / sizeof (tables[0]); ++i)");
+    printLine("  {");
+    printLine("    const PrototypeTable& table = tables[i];");
+    printLine("    if (table.family != family || table.numPoles != numPoles)");
+    printLine("      continue;");
+    printLine("");
+    printLine("    layout.reset ();");
+    printLine("    for (int j = 0; j < numPoles / 2; ++j)");
+    printLine("      layout.addPoleZeroConjugatePairs (");
+    printLine("        complex_t (table.poles[2*j], table.poles[2*j+1]), infinity());");
+    printLine("");
+    printLine("    return true;");
+    printLine("  }");
+    printLine("");
+    printLine("  return false;");
+    printLine("}");
+    printLine("");
+    printLine("bool loadEllipticPrototypeTable (int numPoles,");
+    printLine("                                 double rippleDb,");
+    printLine("                                 double rolloff,");
+    printLine("                                 LayoutBase& layout)");
+    printLine("{");
+    printLine("  const int rippleCount = sizeof (ellipticRipples) / sizeof (ellipticRipples[0]);");
+    printLine("  const int rolloffCount = ellipticRolloffMax - ellipticRolloffMin + 1;");
+    printLine("");
+    printLine("  int ripple = 0;");
+    printLine("  while (ripple < rippleCount && ellipticRipples[ripple] != rippleDb)");
+    printLine("    ++ripple;");
+    printLine("");
+    printLine("  if (ripple == rippleCount ||");
+    printLine("      rolloff < ellipticRolloffMin ||");
+    printLine("      rolloff > ellipticRolloffMax ||");
+    printLine("      rolloff != std::floor (rolloff))");
+    printLine("    return false;");
+    printLine("");
+    printLine("  for (size_t i = 0; i < sizeof (ellipticTables) / sizeof (ellipticTables[0]); ++i)");
+    printLine("  {");
+    printLine("    const EllipticTable& table = ellipticTables[i];");
+    printLine("    if (table.numPoles != numPoles)");
+    printLine("      continue;");
+    printLine("");
+    printLine("    const int entry = ripple * rolloffCount + int (rolloff) - ellipticRolloffMin;");
+    printLine("    const double* p = table.prototypes + entry * (numPoles / 2) * 3;");
+    printLine("");
+    printLine("    layout.reset ();");
+    printLine("    for (int j = 0; j < numPoles / 2; ++j)");
+    printLine("      layout.addPoleZeroConjugatePairs (");
+    printLine("        complex_t (p[3*j], p[3*j+1]), complex_t (0, p[3*j+2]));");
+    printLine("");
+    printLine("    return true;");
+    printLine("  }");
+    printLine("");
+    printLine("  return false;");
+    printLine("}");
+    printLine("");
+    printLine("}");
+
+    return 0;
+}
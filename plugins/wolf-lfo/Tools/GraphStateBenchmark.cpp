@@ -0,0 +1,87 @@
+/*
+ * Throughput of the graph state parser, as used when a session is loaded.
+ * Build with "make benchmark", then run bin/wolf-lfo-graph-state-benchmark.
+ */
+
+#include "Graph.hpp"
+#include "GraphState.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static uint32_t randomState = 1;
+
+static float random01()
+{
+    randomState = randomState * 1664525u + 1013904223u;
+    return (randomState >> 8) / 16777216.0f;
+}
+
+static std::string makeState(int vertexCount)
+{
+    std::string state;
+    char buffer[128];
+
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const float x = i == 0 ? 0.0f : (i == vertexCount - 1 ? 1.0f : (i + random01()) / vertexCount);
+        std::snprintf(buffer, sizeof(buffer), "%a,%a,%a,%d;", x, random01(), random01() * 200.0f - 100.0f, 0);
+        state += buffer;
+    }
+
+    return state;
+}
+
+int main()
+{
+    std::vector<std::string> states;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string state = makeState(2 + i % (wolf::maxStateVertices - 1));
+
+        // a fifth of the states are damaged, like in an old or corrupted session
+        if (i % 5 == 4)
+            state.resize(state.size() / 2);
+
+        states.push_back(state);
+    }
+
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        bytes += states[i].size();
+    }
+
+    const int iterations = 200;
+
+    wolf::Graph graph;
+    int accepted = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            if (wolf::validateGraphState(states[i].c_str()))
+            {
+                graph.rebuildFromString(states[i].c_str());
+                accepted++;
+            }
+        }
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double stateCount = (double)states.size() * iterations;
+
+    std::printf("%d states accepted out of %.0f\n", accepted, stateCount);
+    std::printf("%.2f MB/s\n", bytes * (double)iterations / elapsed.count() / 1e6);
+    std::printf("%.0f states/s\n", stateCount / elapsed.count());
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+/*
+ * libFuzzer target for the graph state parser.
+ * Build with "make fuzz CXX=clang++", then run bin/wolf-lfo-graph-state-fuzzer.
+ */
+
+#include "Graph.hpp"
+#include "GraphState.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    // one byte past the limit is enough for the validator to reject long input
+    static char state[wolf::maxStateLength + 2];
+
+    if (size > wolf::maxStateLength + 1)
+        size = wolf::maxStateLength + 1;
+
+    std::memcpy(state, data, size);
+    state[size] = '\0';
+
+    // the parser itself gets the raw input too, it must not crash or hang on it
+    static wolf::Graph rawGraph;
+    rawGraph.rebuildFromString(state);
+
+    if (!wolf::validateGraphState(state))
+        return 0;
+
+    // states that pass validation must also produce a usable graph
+    static wolf::Graph graph;
+    graph.rebuildFromString(state);
+
+    for (int i = 0; i <= 64; ++i)
+    {
+        const float value = graph.getValueAt(i / 64.0f);
+
+        if (!std::isfinite(value))
+            __builtin_trap();
+    }
+
+    return 0;
+}
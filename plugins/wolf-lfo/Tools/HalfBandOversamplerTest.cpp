@@ -0,0 +1,186 @@
+/*
+ * Checks the half-band oversampler for every factor and quality: the
+ * images of an upsampled sine and the aliases of a downsampled one must
+ * be attenuated as much as the quality promises, and getLatency() must
+ * match the measured round trip delay. Run with "make halfband-test".
+ */
+
+#include "DspFilters/HalfBand.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using Dsp::HalfBandOversampler;
+
+static const int blockSize = 256;
+
+// blocks that run before measuring, for the filters to settle
+static const int settleBlocks = 16;
+
+// base rate samples in the measured window, a power of two so the sines
+// below fall exactly on a frequency bin
+static const int windowSize = 4096;
+
+static const double qualityAttenuations[] = { 70.0, 100.0, 140.0 };
+static const char* const qualityNames[] = { "low", "medium", "high" };
+
+// the measurement itself is only this precise
+static const double attenuationMargin = 0.5;
+static const double latencyTolerance = 0.001;
+
+static int failures = 0;
+
+// Amplitude of the frequency bin of a signal, 1 for a full scale sine
+static double binAmplitude(const std::vector<double>& signal, int bin)
+{
+    const int n = (int)signal.size();
+    double re = 0.0;
+    double im = 0.0;
+
+    for (int i = 0; i < n; ++i)
+    {
+        const double phase = 2.0 * M_PI * (double)bin * i / n;
+        re += signal[i] * std::cos(phase);
+        im -= signal[i] * std::sin(phase);
+    }
+
+    return 2.0 * std::sqrt(re * re + im * im) / n;
+}
+
+static double toDecibels(double ratio)
+{
+    return 20.0 * std::log10(std::max(ratio, 1e-30));
+}
+
+// Upsamples a sine and measures its strongest image at the high rate
+static double measureImages(HalfBandOversampler& oversampler, int factor, int bin)
+{
+    std::vector<double> output;
+    std::vector<double> input(blockSize);
+    const double* channels[1] = { &input[0] };
+
+    for (int block = 0; block < settleBlocks + windowSize / blockSize; ++block)
+    {
+        for (int i = 0; i < blockSize; ++i)
+        {
+            input[i] = std::sin(2.0 * M_PI * (double)bin * (block * blockSize + i) / windowSize);
+        }
+
+        double* const* up = oversampler.upsample(blockSize, channels);
+
+        if (block >= settleBlocks)
+            output.insert(output.end(), up[0], up[0] + factor * blockSize);
+    }
+
+    const double signal = binAmplitude(output, bin);
+    double image = 0.0;
+
+    for (int k = 1; k < factor; ++k)
+    {
+        image = std::max(image, binAmplitude(output, k * windowSize + bin));
+        image = std::max(image, binAmplitude(output, k * windowSize - bin));
+    }
+
+    return toDecibels(signal / image);
+}
+
+// Downsamples a sine above the base band and measures what is left of it
+static double measureAliases(HalfBandOversampler& oversampler, int factor, int highBin)
+{
+    std::vector<double> output;
+    std::vector<double> input(blockSize);
+    double* channels[1] = { &input[0] };
+
+    for (int block = 0; block < settleBlocks + windowSize / blockSize; ++block)
+    {
+        double* const* up = oversampler.upsample(blockSize, (const double* const*)channels);
+
+        for (int i = 0; i < factor * blockSize; ++i)
+        {
+            up[0][i] = std::sin(2.0 * M_PI * (double)highBin * (block * factor * blockSize + i) / (factor * windowSize));
+        }
+
+        oversampler.downsample(blockSize, channels);
+
+        if (block >= settleBlocks)
+            output.insert(output.end(), input.begin(), input.end());
+    }
+
+    const int aliasBin = highBin % windowSize;
+    const int foldedBin = aliasBin > windowSize / 2 ? windowSize - aliasBin : aliasBin;
+
+    return toDecibels(1.0 / binAmplitude(output, foldedBin));
+}
+
+// Round trip delay at DC, the first moment of the impulse response
+static double measureLatency(HalfBandOversampler& oversampler)
+{
+    std::vector<double> buffer(blockSize);
+    double* channels[1] = { &buffer[0] };
+
+    double sum = 0.0;
+    double moment = 0.0;
+
+    for (int block = 0; block < 64; ++block)
+    {
+        for (int i = 0; i < blockSize; ++i)
+        {
+            buffer[i] = block == 0 && i == 0 ? 1.0 : 0.0;
+        }
+
+        oversampler.upsample(blockSize, (const double* const*)channels);
+        oversampler.downsample(blockSize, channels);
+
+        for (int i = 0; i < blockSize; ++i)
+        {
+            sum += buffer[i];
+            moment += (block * blockSize + i) * buffer[i];
+        }
+    }
+
+    return moment / sum;
+}
+
+int main()
+{
+    for (int factor = 2; factor <= 16; factor *= 2)
+    {
+        for (int quality = 0; quality < 3; ++quality)
+        {
+            HalfBandOversampler oversampler;
+            oversampler.setup(factor, (HalfBandOversampler::Quality)quality, 1, blockSize);
+
+            const double required = qualityAttenuations[quality] - attenuationMargin;
+
+            // 0.15 of the base rate, well inside the pass band
+            const double images = measureImages(oversampler, factor, windowSize * 15 / 100);
+
+            // 0.65 of the base rate, past the stop band edge of every quality
+            oversampler.reset();
+            const double aliases = measureAliases(oversampler, factor, windowSize * 65 / 100);
+
+            oversampler.reset();
+            const double latency = measureLatency(oversampler);
+
+            const bool ok = images >= required
+                && aliases >= required
+                && std::fabs(latency - oversampler.getLatency()) < latencyTolerance;
+
+            std::printf("%s factor %2d, %-6s quality: images %6.1f dB, aliases %6.1f dB, latency %.4f (reported %.4f)\n",
+                        ok ? "ok  " : "FAIL", factor, qualityNames[quality], images, aliases, latency, oversampler.getLatency());
+
+            if (!ok)
+                ++failures;
+        }
+    }
+
+    if (failures != 0)
+    {
+        std::printf("%d configurations failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
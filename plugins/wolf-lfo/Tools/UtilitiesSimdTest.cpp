@@ -0,0 +1,187 @@
+/*
+ * Compares the vectorized buffer routines of DspFilters/Utilities.h with
+ * the scalar templates they overload. Every length from 0 to maxLength is
+ * tried, so the odd tails are covered, and every buffer starts one to
+ * three samples past an aligned address.
+ *
+ * "make simd-test" builds and runs it once for SSE2 and once for AVX2.
+ */
+
+#include "DspFilters/Utilities.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+#if !DSPFILTERS_SIMD_BUFFERS
+#error "Build with -msse2 or -mavx2, there is nothing to compare otherwise"
+#endif
+
+static const int maxLength = 67;
+static const int maxOffset = 3;
+
+// room for an interleaved buffer at the largest offset
+static const int bufferSize = 2 * maxLength + 2 * maxOffset + 8;
+
+static int failures = 0;
+
+static uint32_t randomState = 1;
+
+static double random11()
+{
+    randomState = randomState * 1664525u + 1013904223u;
+    return (randomState >> 8) / 8388608.0 - 1.0;
+}
+
+template <typename T>
+struct Buffer
+{
+    alignas(32) T data[bufferSize];
+
+    void fill()
+    {
+        for (int i = 0; i < bufferSize; ++i)
+        {
+            data[i] = T(random11());
+        }
+    }
+};
+
+template <typename T>
+static T tolerance()
+{
+    return sizeof(T) == sizeof(float) ? T(1e-5) : T(1e-13);
+}
+
+template <typename T>
+static bool same(T a, T b, bool exact)
+{
+    if (exact)
+        return a == b;
+
+    return std::fabs(a - b) <= tolerance<T>() * (1 + std::fabs(a) + std::fabs(b));
+}
+
+template <typename T>
+static void compare(const char* name, const char* type, int length, int offset,
+                    const T* simd, const T* scalar, int count, bool exact)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        if (!same(simd[i], scalar[i], exact))
+        {
+            std::printf("FAIL %s<%s> length %d offset %d: sample %d is %.17g, expected %.17g\n",
+                        name, type, length, offset, i, double(simd[i]), double(scalar[i]));
+            ++failures;
+            return;
+        }
+    }
+}
+
+template <typename T>
+static void checkType(const char* type)
+{
+    Buffer<T> a, b, c, simd, scalar, simdRight, scalarRight;
+
+    for (int offset = 1; offset <= maxOffset; ++offset)
+    {
+        for (int n = 0; n <= maxLength; ++n)
+        {
+            a.fill();
+            b.fill();
+            c.fill();
+
+            T* const x = a.data + offset;
+            T* const y = b.data + offset;
+            T* const z = c.data + offset;
+            T* const s = simd.data + offset;
+            T* const r = scalar.data + offset;
+            T* const sr = simdRight.data + offset;
+            T* const rr = scalarRight.data + offset;
+
+            // the output buffers start out equal, for the in place routines
+            Dsp::copy(bufferSize, simd.data, a.data);
+            Dsp::copy(bufferSize, scalar.data, a.data);
+            Dsp::add(n, s, y);
+            Dsp::add<T, T>(n, r, y);
+            compare("add", type, n, offset, simd.data, scalar.data, bufferSize, true);
+
+            Dsp::copy(bufferSize, simd.data, a.data);
+            Dsp::copy(bufferSize, scalar.data, a.data);
+            Dsp::multiply(n, s, T(0.3));
+            Dsp::multiply<T, T>(n, r, T(0.3));
+            compare("multiply", type, n, offset, simd.data, scalar.data, bufferSize, true);
+
+            Dsp::copy(bufferSize, simd.data, a.data);
+            Dsp::copy(bufferSize, scalar.data, a.data);
+            Dsp::fade(n, s, T(0.25), T(0.75));
+            Dsp::fade<T, T>(n, r, T(0.25), T(0.75));
+            compare("fade", type, n, offset, simd.data, scalar.data, bufferSize, false);
+
+            Dsp::copy(bufferSize, simd.data, a.data);
+            Dsp::copy(bufferSize, scalar.data, a.data);
+            Dsp::fade(n, s, z, T(1), T(0));
+            Dsp::fade<T, T, T>(n, r, z, T(1), T(0));
+            compare("fade from source", type, n, offset, simd.data, scalar.data, bufferSize, false);
+
+            Dsp::copy(bufferSize, simd.data, c.data);
+            Dsp::copy(bufferSize, scalar.data, c.data);
+            const T* const channels[2] = { x, y };
+            Dsp::interleave(2, n, s, channels);
+            Dsp::interleave<T, T>(2, n, r, channels);
+            compare("interleave", type, n, offset, simd.data, scalar.data, bufferSize, true);
+
+            Dsp::copy(bufferSize, simd.data, c.data);
+            Dsp::copy(bufferSize, scalar.data, c.data);
+            Dsp::copy(bufferSize, simdRight.data, c.data);
+            Dsp::copy(bufferSize, scalarRight.data, c.data);
+            T* const simdChannels[2] = { s, sr };
+            T* const scalarChannels[2] = { r, rr };
+            Dsp::deinterleave(2, n, simdChannels, x);
+            Dsp::deinterleave<T, T>(2, n, scalarChannels, x);
+            compare("deinterleave left", type, n, offset, simd.data, scalar.data, bufferSize, true);
+            compare("deinterleave right", type, n, offset, simdRight.data, scalarRight.data, bufferSize, true);
+
+            Dsp::copy(bufferSize, simd.data, c.data);
+            Dsp::copy(bufferSize, scalar.data, c.data);
+            Dsp::reverse(n, s, x);
+            Dsp::reverse<T, T>(n, r, x);
+            compare("reverse", type, n, offset, simd.data, scalar.data, bufferSize, true);
+
+            Dsp::copy(bufferSize, simd.data, c.data);
+            Dsp::copy(bufferSize, scalar.data, c.data);
+            Dsp::to_mono(n, s, x, y);
+            Dsp::to_mono<T>(n, r, x, y);
+            compare("to_mono", type, n, offset, simd.data, scalar.data, bufferSize, true);
+
+            const T simdPeak = Dsp::peak(n, x);
+            const T scalarPeak = Dsp::peak<T>(n, x);
+            compare("peak", type, n, offset, &simdPeak, &scalarPeak, 1, true);
+
+            T simdStats[2], scalarStats[2];
+            Dsp::peak_and_energy(n, x, simdStats[0], simdStats[1]);
+            Dsp::peak_and_energy<T>(n, x, scalarStats[0], scalarStats[1]);
+            compare("peak_and_energy", type, n, offset, simdStats, scalarStats, 2, false);
+        }
+    }
+}
+
+int main()
+{
+    std::printf("%d float and %d double lanes\n",
+                int(Dsp::SimdVector<float>::type::size),
+                int(Dsp::SimdVector<double>::type::size));
+
+    checkType<float>("float");
+    checkType<double>("double");
+
+    if (failures != 0)
+    {
+        std::printf("%d comparisons failed\n", failures);
+        return 1;
+    }
+
+    std::printf("ok\n");
+
+    return 0;
+}
@@ -17,6 +17,40 @@ enum Parameters
     paramPhase,
     paramSmoothing,
     paramPlayheadPos,
+    paramMakeupGain,
+    paramMorph,
+    paramBandCount,
+    paramCrossover1,
+    paramCrossover2,
+    paramCrossover3,
+    paramLinearPhase,
+    paramBandRate1,
+    paramBandRate2,
+    paramBandRate3,
+    paramBandRate4,
+    paramBandDepth1,
+    paramBandDepth2,
+    paramBandDepth3,
+    paramBandDepth4,
+    paramBandMorph1,
+    paramBandMorph2,
+    paramBandMorph3,
+    paramBandMorph4,
+    paramSmoothingMode,
+    paramSlewRise,
+    paramSlewFall,
+    paramRateModifier,
+    paramTempoPrediction,
+    paramInputPeak,
+    paramInputRMS,
+    paramOutputPeak,
+    paramOutputRMS,
+    paramModulationDepth,
+    paramShapeMin,
+    paramShapeMax,
+    paramShapeMean,
+    paramShapeRMS,
+    paramShapeIntegral,
     paramCount
 };
 
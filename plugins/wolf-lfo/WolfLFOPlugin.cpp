@@ -24,9 +24,14 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
 
 #include "WolfLFOParameters.hpp"
 #include "Graph.hpp"
+#include "ShapeSlot.hpp"
+#include "CrossoverBank.hpp"
+#include "LinearPhaseCrossover.hpp"
+#include "OutputSmoother.hpp"
 #include "Oversampler.hpp"
 #include "ParamSmooth.hpp"
 #include "Mathf.hpp"
@@ -65,79 +70,228 @@ enum LFORate
 	LFORatesCount
 };
 
-static float getLFORateInBars(LFORate rate)
+// Length of one LFO cycle for each LFORate, in bars
+static constexpr float lfoRatesInBars[LFORatesCount] = {
+	16.0f, 12.0f, 9.0f, 8.0f, 6.0f, 4.0f, 3.0f, 2.0f, 1.5f, 1.0f,
+	1.0f / 2.0f, 1.0f / 3.0f, 1.0f / 4.0f, 1.0f / 6.0f, 1.0f / 8.0f, 1.0f / 9.0f,
+	1.0f / 12.0f, 1.0f / 16.0f, 1.0f / 32.0f, 1.0f / 64.0f,
+	1.0f / 128.0f, 1.0f / 256.0f, 1.0f / 512.0f};
+
+enum LFORateModifier
+{
+	rateStraight = 0,
+	rateDotted,
+	rateTriplet,
+	rateModifiersCount
+};
+
+// A dotted note lasts one and a half times as long, a triplet two thirds
+static constexpr float lfoRateModifiers[rateModifiersCount] = {1.0f, 1.5f, 2.0f / 3.0f};
+
+static float getLFORateInBars(int rate, int modifier)
+{
+	DISTRHO_SAFE_ASSERT_RETURN(rate >= 0 && rate < LFORatesCount, 1);
+	DISTRHO_SAFE_ASSERT_RETURN(modifier >= 0 && modifier < rateModifiersCount, 1);
+
+	return lfoRatesInBars[rate] * lfoRateModifiers[modifier];
+}
+
+enum GraphSlot
+{
+	graphSlotA = 0,
+	graphSlotB,
+	graphSlotCount
+};
+
+// The editor only ever writes the "graph" state, so that state holds the slot
+// being edited and "graphB" holds the other one. "graphslot" tells which slot is
+// in "graph", and the editor sends "selectslot" to edit the other slot.
+enum State
+{
+	stateEditedGraph = 0,
+	stateOtherGraph,
+	stateEditedSlot,
+	stateSelectSlot,
+	stateCount
+};
+
+// Upper bound for the automatic makeup gain, so flat shapes near zero don't explode
+static const float maxMakeupGain = 4.0f;
+
+// The warp counts as settled within half a step of the shape cache quantization
+static const float warpSettledTolerance = 1.0f / 2048.0f;
+
+// Tempo prediction: fraction of the phase error corrected over one block,
+// larger errors mean the host relocated and the playhead jumps instead
+static const float phaseLockGain = 0.5f;
+static const float maxPhaseError = 0.25f;
+
+// Silent blocks are skipped once the crossover had this long to ring out,
+// and the wet and post gain smoothers are this close to their target
+static const float silenceThreshold = 0.00001f;
+static const float silenceTailTime = 0.2f;
+static const float settledTolerance = 0.0001f;
+
+// Range of the level meters, in dB
+static const float minMeterLevel = -60.0f;
+static const float maxMeterLevel = 6.0f;
+
+static const char *const meterNames[] = {"Input Peak", "Input RMS", "Output Peak", "Output RMS"};
+static const char *const meterSymbols[] = {"inpeak", "inrms", "outpeak", "outrms"};
+
+//generated with fprintf(stderr, "%A,%A,%A,%d;%A,%A,%A,%d;\n", 0.0f, 0.0f, 0.0f, wolf::CurveType::Exponential, 1.0f, 1.0f, 0.0f, wolf::CurveType::Exponential);
+static const char *const defaultGraphState = "0x0p+0,0x0p+0,0x0p+0,0;0x1p+0,0x1p+0,0x0p+0,0;";
+
+static const char *const shapeStatisticNames[] = {"Shape Min", "Shape Max", "Shape Mean", "Shape RMS", "Shape Integral"};
+static const char *const shapeStatisticSymbols[] = {"shapemin", "shapemax", "shapemean", "shaperms", "shapeintegral"};
+
+static float getLevelInDecibels(float level)
+{
+	if (level <= 0.0f)
+		return minMeterLevel;
+
+	return std::max(minMeterLevel, std::min(maxMeterLevel, 20.0f * std::log10(level)));
+}
+
+// Adds the peak and the sum of squares of a stereo chunk to the totals of the block
+static void addLevels(const float *left, const float *right, uint32_t frames, float &peak, float &energy)
 {
-	DISTRHO_SAFE_ASSERT_RETURN(rate != LFORatesCount, 1);
-
-	switch (rate)
-	{
-	case SixteenBar:
-		return 16;
-	case TwelveBar:
-		return 12;
-	case NineBar:
-		return 9;
-	case EightBar:
-		return 8;
-	case SixBar:
-		return 6;
-	case FourBar:
-		return 4;
-	case ThreeBar:
-		return 3;
-	case TwoBar:
-		return 2;
-	case OneAndHalfBar:
-		return 1.5f;
-	case OneBar:
-		return 1;
-	case HalfBar:
-		return 1.0f / 2.0f;
-	case OneThirdBar:
-		return 1.0f / 3.0f;
-	case OneFourthBar:
-		return 1.0f / 4.0f;
-	case OneSixthBar:
-		return 1.0f / 6.0f;
-	case OneEighthBar:
-		return 1.0f / 8.0f;
-	case OneNinthBar:
-		return 1.0f / 9.0f;
-	case OneTwelfthBar:
-		return 1.0f / 12.0f;
-	case OneSixteenthBar:
-		return 1.0f / 16.0f;
-	case OneThirtyTwoBar:
-		return 1.0f / 32.0f;
-	case OneSixtyFourthBar:
-		return 1.0f / 64.0f;
-	case OneOneHundredTwentyEighthBar:
-		return 1.0f / 128.0f;
-	case OneTwoHundredFiftySixthBar:
-		return 1.0f / 256.0f;
-	case OneFiveHundredTwelveBar:
-		return 1.0f / 512.0f;
-	case LFORatesCount:
-		return 1;
-	}
-
-	return 1;
+	const float *const channels[2] = {left, right};
+
+	for (int c = 0; c < 2; ++c)
+	{
+		float channelPeak;
+		float channelEnergy;
+
+		Dsp::peak_and_energy(frames, channels[c], channelPeak, channelEnergy);
+
+		peak = std::max(peak, channelPeak);
+		energy += channelEnergy;
+	}
 }
 
+static const int maxBands = wolf::CrossoverBank::maxBands;
+
+// Blocks are processed in chunks of this many frames, so the pre gained input
+// fits in a fixed buffer that the linear phase crossover splits at once
+static const uint32_t processChunkFrames = 128;
+
+// Crossover automation glides in log frequency instead of jumping,
+// the filters are redesigned once per chunk while it moves
+static const float crossoverGlideTime = 0.05f;
+static const float crossoverSettledTolerance = 0.001f;
+
+static const char *const bandRateNames[maxBands] = {"Band 1 Rate", "Band 2 Rate", "Band 3 Rate", "Band 4 Rate"};
+static const char *const bandRateSymbols[maxBands] = {"bandrate1", "bandrate2", "bandrate3", "bandrate4"};
+static const char *const bandDepthNames[maxBands] = {"Band 1 Depth", "Band 2 Depth", "Band 3 Depth", "Band 4 Depth"};
+static const char *const bandDepthSymbols[maxBands] = {"banddepth1", "banddepth2", "banddepth3", "banddepth4"};
+static const char *const bandMorphNames[maxBands] = {"Band 1 Morph", "Band 2 Morph", "Band 3 Morph", "Band 4 Morph"};
+static const char *const bandMorphSymbols[maxBands] = {"bandmorph1", "bandmorph2", "bandmorph3", "bandmorph4"};
+
+static const char *const crossoverNames[maxBands - 1] = {"Crossover 1", "Crossover 2", "Crossover 3"};
+static const char *const crossoverSymbols[maxBands - 1] = {"crossover1", "crossover2", "crossover3"};
+static const float crossoverDefaults[maxBands - 1] = {200.0f, 1000.0f, 5000.0f};
+
 static float getFreeLFORate(float rate)
 {
 	return wolf::logScale(rate + 1, 1, LFORatesCount) - 1;
 }
 
+// Cutoff of the parameter smoothers, in Hz
+static const float parameterSmoothingFrequency = 20.0f;
+
+// Terms of the series in sumFreeLFORates, it has converged long before for any rate range
+static const int maxRateSeriesTerms = 48;
+
+// Sum of getFreeLFORate() over frames smoothed rates, from first towards target.
+// The smoother moves the rate geometrically, rate_m = target + (first - target) * pole^m,
+// and the free rate is exp(c * rate) - 1. Expanding exp(c * (first - target) * pole^m)
+// as a power series turns the sum over m into one geometric sum per term.
+// poleToFrames is pole^frames.
+static double sumFreeLFORates(float first, float target, float pole, float poleToFrames, uint32_t frames)
+{
+	const double c = std::log((double)LFORatesCount) / (LFORatesCount - 1);
+	const double x = c * (first - target);
+
+	double sum = frames;
+	double term = 1.0;
+	double poleToK = 1.0;
+	double poleToKFrames = 1.0;
+
+	for (int k = 1; k <= maxRateSeriesTerms; ++k)
+	{
+		term *= x / k;
+		poleToK *= pole;
+		poleToKFrames *= poleToFrames;
+
+		const double contribution = term * (1.0 - poleToKFrames) / (1.0 - poleToK);
+		sum += contribution;
+
+		if (std::abs(contribution) < 1e-12 * sum)
+			break;
+	}
+
+	return std::exp(c * target) * sum - frames;
+}
+
+// Per-sample playhead increment, only recomputed when the rate it comes from changes
+struct PlayheadIncrement
+{
+	PlayheadIncrement() : freeRate(-1.0f), increment(0.0f), ramp(0.0f)
+	{
+	}
+
+	// smoothed rate parameter the free increment was computed from, negative when stale
+	float freeRate;
+	float increment;
+
+	// added to the synced increment every sample while a tempo ramp is extrapolated
+	float ramp;
+};
+
 class WolfLFO : public Plugin
 {
   public:
-	WolfLFO() : Plugin(paramCount, 0, 1),
-				graphOutput(),
-				mustCopyLineEditor(false),
-				PlayheadPos(0.0f)
+	WolfLFO() : Plugin(paramCount, 0, stateCount),
+				editedSlot(graphSlotA),
+				horizontalWarpType((wolf::WarpType)0),
+				warpAmount(0.0f),
+				warpIsMoving(false),
+				PlayheadPos(0.0f),
+				samplePeriod(1.0f / getSampleRate()),
+				bpmSync(true),
+				predictTempo(false),
+				lastBeatsPerMinute(0.0f),
+				lastBlockFrames(0),
+				tempoSlope(0.0f),
+				smootherPole(std::exp(-2.0f * (float)M_PI * parameterSmoothingFrequency / getSampleRate())),
+				smootherDecayFrames(0),
+				smootherDecay(1.0f),
+				silentSamples(0),
+				silenceTailSamples(0),
+				lastWet(1.0f),
+				lastPostGain(1.0f),
+				mustUpdateSmoothers(true),
+				mustUpdateCrossover(true),
+				crossoverIsMoving(false),
+				crossoverGlideCoeff(1.0f),
+				linearPhase(false)
 	{
-		graphOutput.calculateCoeff(20.f, getSampleRate());
+		for (int i = 0; i < maxBands; ++i)
+		{
+			bandPlayheads[i] = 0.0f;
+		}
+
+		for (int i = 0; i < maxBands - 1; ++i)
+		{
+			crossoverFrequencies[i] = crossoverDefaults[i];
+		}
+
+		for (int i = 0; i < graphSlotCount; ++i)
+		{
+			graphStates[i] = defaultGraphState;
+			slotStatistics[i] = graphSlots[i].getStatistics(horizontalWarpType, warpAmount);
+		}
 	}
 
   protected:
@@ -262,10 +416,162 @@ class WolfLFO : public Plugin
 			parameter.hints = kParameterIsOutput;
 			parameter.ranges.def = 0.0f;
 			break;
+		case paramMakeupGain:
+			parameter.name = "Makeup Gain";
+			parameter.symbol = "makeupgain";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			parameter.hints = kParameterIsAutomable | kParameterIsBoolean;
+			break;
+		case paramMorph:
+			parameter.name = "Morph";
+			parameter.symbol = "morph";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			parameter.hints = kParameterIsAutomable;
+			break;
+		case paramBandCount:
+			parameter.name = "Bands";
+			parameter.symbol = "bands";
+			parameter.ranges.min = 1.0f;
+			parameter.ranges.max = maxBands;
+			parameter.ranges.def = 1.0f;
+			parameter.hints = kParameterIsAutomable | kParameterIsInteger;
+			break;
+		case paramCrossover1:
+		case paramCrossover2:
+		case paramCrossover3:
+			parameter.name = crossoverNames[index - paramCrossover1];
+			parameter.symbol = crossoverSymbols[index - paramCrossover1];
+			parameter.ranges.min = 20.0f;
+			parameter.ranges.max = 20000.0f;
+			parameter.ranges.def = crossoverDefaults[index - paramCrossover1];
+			parameter.hints = kParameterIsAutomable | kParameterIsLogarithmic;
+			break;
+		case paramLinearPhase:
+			// not automatable, it changes the latency
+			parameter.name = "Linear Phase Crossover";
+			parameter.symbol = "linearphase";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			parameter.hints = kParameterIsBoolean;
+			break;
+		case paramBandRate1:
+		case paramBandRate2:
+		case paramBandRate3:
+		case paramBandRate4:
+			parameter.name = bandRateNames[index - paramBandRate1];
+			parameter.symbol = bandRateSymbols[index - paramBandRate1];
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = LFORatesCount - 1;
+			parameter.ranges.def = OneFourthBar;
+			parameter.hints = kParameterIsAutomable;
+			break;
+		case paramBandDepth1:
+		case paramBandDepth2:
+		case paramBandDepth3:
+		case paramBandDepth4:
+			parameter.name = bandDepthNames[index - paramBandDepth1];
+			parameter.symbol = bandDepthSymbols[index - paramBandDepth1];
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 1.0f;
+			parameter.hints = kParameterIsAutomable;
+			break;
+		case paramBandMorph1:
+		case paramBandMorph2:
+		case paramBandMorph3:
+		case paramBandMorph4:
+			parameter.name = bandMorphNames[index - paramBandMorph1];
+			parameter.symbol = bandMorphSymbols[index - paramBandMorph1];
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			parameter.hints = kParameterIsAutomable;
+			break;
+		case paramSmoothingMode:
+			//One-pole, Two-pole, Butterworth, Slew
+			parameter.name = "Smoothing Mode";
+			parameter.symbol = "smoothingmode";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = wolf::smoothingModeCount - 1;
+			parameter.ranges.def = wolf::smoothingOnePole;
+			parameter.hints = kParameterIsAutomable | kParameterIsInteger;
+			break;
+		case paramSlewRise:
+			parameter.name = "Slew Rise";
+			parameter.symbol = "slewrise";
+			parameter.unit = "ms";
+			parameter.ranges.min = 0.1f;
+			parameter.ranges.max = 1000.0f;
+			parameter.ranges.def = 10.0f;
+			parameter.hints = kParameterIsAutomable | kParameterIsLogarithmic;
+			break;
+		case paramSlewFall:
+			parameter.name = "Slew Fall";
+			parameter.symbol = "slewfall";
+			parameter.unit = "ms";
+			parameter.ranges.min = 0.1f;
+			parameter.ranges.max = 1000.0f;
+			parameter.ranges.def = 50.0f;
+			parameter.hints = kParameterIsAutomable | kParameterIsLogarithmic;
+			break;
+		case paramRateModifier:
+			//Straight, Dotted, Triplet
+			parameter.name = "Rate Modifier";
+			parameter.symbol = "ratemodifier";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = rateModifiersCount - 1;
+			parameter.ranges.def = rateStraight;
+			parameter.hints = kParameterIsAutomable | kParameterIsInteger;
+			break;
+		case paramTempoPrediction:
+			parameter.name = "Tempo Prediction";
+			parameter.symbol = "tempoprediction";
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			parameter.hints = kParameterIsAutomable | kParameterIsBoolean;
+			break;
+		case paramInputPeak:
+		case paramInputRMS:
+		case paramOutputPeak:
+		case paramOutputRMS:
+			parameter.name = meterNames[index - paramInputPeak];
+			parameter.symbol = meterSymbols[index - paramInputPeak];
+			parameter.unit = "dB";
+			parameter.hints = kParameterIsOutput;
+			parameter.ranges.min = minMeterLevel;
+			parameter.ranges.max = maxMeterLevel;
+			parameter.ranges.def = minMeterLevel;
+			break;
+		case paramModulationDepth:
+			parameter.name = "Modulation Depth";
+			parameter.symbol = "moddepth";
+			parameter.hints = kParameterIsOutput;
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			break;
+		case paramShapeMin:
+		case paramShapeMax:
+		case paramShapeMean:
+		case paramShapeRMS:
+		case paramShapeIntegral:
+			parameter.name = shapeStatisticNames[index - paramShapeMin];
+			parameter.symbol = shapeStatisticSymbols[index - paramShapeMin];
+			parameter.hints = kParameterIsOutput;
+			parameter.ranges.min = 0.0f;
+			parameter.ranges.max = 1.0f;
+			parameter.ranges.def = 0.0f;
+			break;
 		}
 
 		parameters[index] = ParamSmooth(parameter.ranges.def);
-		parameters[index].calculateCoeff(20.f, getSampleRate());
+		parameters[index].calculateCoeff(parameterSmoothingFrequency, getSampleRate());
 	}
 
 	float getParameterValue(uint32_t index) const override
@@ -276,19 +582,92 @@ class WolfLFO : public Plugin
 	void setParameterValue(uint32_t index, float value) override
 	{
 		parameters[index].setValue(value);
+
+		// picked up at the start of the next block
+		switch (index)
+		{
+		case paramSmoothing:
+		case paramSmoothingMode:
+		case paramSlewRise:
+		case paramSlewFall:
+			mustUpdateSmoothers = true;
+			break;
+		case paramBandCount:
+		case paramLinearPhase:
+			mustUpdateCrossover = true;
+			break;
+		case paramCrossover1:
+		case paramCrossover2:
+		case paramCrossover3:
+			crossoverIsMoving = true;
+			break;
+		}
+	}
+
+	void activate() override
+	{
+		prepare(getSampleRate());
+		crossover.reset();
+		linearPhaseCrossover.reset();
+
+		lastBeatsPerMinute = 0.0f;
+		silentSamples = 0;
+	}
+
+	void sampleRateChanged(double newSampleRate) override
+	{
+		prepare(newSampleRate);
+	}
+
+	// Computes everything that depends on the sample rate,
+	// so run() only has to follow parameter changes
+	void prepare(double sampleRate)
+	{
+		for (int i = 0; i < paramCount; ++i)
+		{
+			parameters[i].calculateCoeff(parameterSmoothingFrequency, sampleRate);
+		}
+
+		smootherPole = std::exp(-2.0f * (float)M_PI * parameterSmoothingFrequency / sampleRate);
+		smootherDecayFrames = 0;
+		smootherDecay = 1.0f;
+
+		samplePeriod = 1.0f / sampleRate;
+		silenceTailSamples = sampleRate * silenceTailTime;
+		crossoverGlideCoeff = 1.0f - std::exp(-(float)processChunkFrames / (crossoverGlideTime * sampleRate));
+
+		playheadIncrement = PlayheadIncrement();
+
+		for (int b = 0; b < maxBands; ++b)
+		{
+			bandIncrements[b] = PlayheadIncrement();
+		}
+
+		updateSmoothers(sampleRate);
+		updateCrossover(sampleRate);
 	}
 
 	void initState(uint32_t index, String &stateKey, String &defaultStateValue) override
 	{
 		switch (index)
 		{
-		case 0:
+		case stateEditedGraph:
 			stateKey = "graph";
+			defaultStateValue = defaultGraphState;
+			break;
+		case stateOtherGraph:
+			stateKey = "graphB";
+			defaultStateValue = defaultGraphState;
+			break;
+		case stateEditedSlot:
+			stateKey = "graphslot";
+			defaultStateValue = "A";
+			break;
+		case stateSelectSlot:
+			stateKey = "selectslot";
+			defaultStateValue = "";
 			break;
 		}
-
-		//generated with fprintf(stderr, "%A,%A,%A,%d;%A,%A,%A,%d;\n", 0.0f, 0.0f, 0.0f, wolf::CurveType::Exponential, 1.0f, 1.0f, 0.0f, wolf::CurveType::Exponential);
-		defaultStateValue = String("0x0p+0,0x0p+0,0x0p+0,0;0x1p+0,0x1p+0,0x0p+0,0;");
 	}
 
 	void setState(const char *key, const char *value) override
@@ -297,20 +676,141 @@ class WolfLFO : public Plugin
 
 		if (std::strcmp(key, "graph") == 0)
 		{
-			tempLineEditor.rebuildFromString(value);
-			mustCopyLineEditor = true;
+			setSlotGraph(editedSlot, value);
+		}
+		else if (std::strcmp(key, "graphB") == 0)
+		{
+			setSlotGraph(1 - editedSlot, value);
 		}
+		else if (std::strcmp(key, "graphslot") == 0)
+		{
+			// The graphs stay bound to their state keys, so a host can restore
+			// the three states in any order
+			if (getSlotFromState(value) != editedSlot)
+			{
+				const String editedGraph = graphStates[editedSlot];
+
+				editedSlot = 1 - editedSlot;
+				setSlotGraph(1 - editedSlot, graphStates[editedSlot]);
+				setSlotGraph(editedSlot, editedGraph);
+			}
+		}
+		else if (std::strcmp(key, "selectslot") == 0)
+		{
+			// The slots keep their graphs, the editor moves to the other one
+			if (value[0] != '\0')
+				editedSlot = getSlotFromState(value);
+		}
+	}
+
+	String getState(const char *key) const override
+	{
+		const MutexLocker cml(mutex);
+
+		if (std::strcmp(key, "graph") == 0)
+			return graphStates[editedSlot];
+
+		if (std::strcmp(key, "graphB") == 0)
+			return graphStates[1 - editedSlot];
+
+		if (std::strcmp(key, "graphslot") == 0)
+			return String(editedSlot == graphSlotA ? "A" : "B");
+
+		// "selectslot" is a request from the editor, restoring it does nothing
+		return String("");
+	}
+
+	static int getSlotFromState(const char *value)
+	{
+		return std::strcmp(value, "B") == 0 ? graphSlotB : graphSlotA;
+	}
+
+	void setSlotGraph(int slot, const char *value)
+	{
+		const wolf::WarpType warpType = (wolf::WarpType)std::round(parameters[paramHorizontalWarpType].getRawValue());
+
+		if (graphSlots[slot].setGraph(value, warpType, warpAmount))
+			graphStates[slot] = value;
 	}
 
-	float getGraphValue(float input)
+	float getSlotValue(int slot, float input)
 	{
-		return lineEditor.getValueAt(input);
+		if (warpIsMoving)
+			return graphSlots[slot].getWarpedValueAt(input, horizontalWarpType, warpAmount);
+
+		return graphSlots[slot].getTable().getValueAt(input);
+	}
+
+	// Crossfades the shapes of both graph slots
+	float getGraphValue(float input, float morph)
+	{
+		const float valueA = getSlotValue(graphSlotA, input);
+
+		if (morph <= 0.0f)
+			return valueA;
+
+		const float valueB = getSlotValue(graphSlotB, input);
+
+		return valueA + (valueB - valueA) * morph;
+	}
+
+	// The graph output mapped to the gain applied to the audio
+	float getScaledGraphValue(float input, float morph)
+	{
+		const float rawGraphOutput = getGraphValue(input, morph);
+
+		const double euler = std::exp(1.0);
+		return (std::exp(rawGraphOutput) - 1) / (euler - 1);
+	}
+
+	// The baked tables only follow the warp once it settled on its target,
+	// until then the unwarped tables are read with the smoothed warp of each sample
+	void updateShapes()
+	{
+		horizontalWarpType = (wolf::WarpType)std::round(parameters[paramHorizontalWarpType].getRawValue());
+
+		const float warpTarget = parameters[paramHorizontalWarpAmount].getRawValue();
+
+		warpIsMoving = std::abs(warpAmount - warpTarget) > warpSettledTolerance;
+
+		for (int i = 0; i < graphSlotCount; ++i)
+		{
+			slotStatistics[i] = graphSlots[i].getStatistics(horizontalWarpType, warpAmount);
+		}
+
+		if (warpIsMoving)
+			return;
+
+		for (int i = 0; i < graphSlotCount; ++i)
+		{
+			graphSlots[i].setWarp(horizontalWarpType, warpTarget);
+		}
 	}
 
-	void synchronizePlayhead()
+	// Compensates the average attenuation of the current shape
+	float getMakeupGain()
 	{
-		const bool bpmSync = std::round(parameters[paramBPMSync].getRawValue());
+		const bool makeupGain = std::round(parameters[paramMakeupGain].getRawValue());
+
+		if (!makeupGain)
+			return 1.0f;
+
+		//approximation: the mean gain of a crossfade isn't linear in the morph amount
+		const float morph = parameters[paramMorph].getRawValue();
+		const float meanGainA = slotStatistics[graphSlotA].meanGain;
+		const float meanGainB = slotStatistics[graphSlotB].meanGain;
+		const float meanGain = meanGainA + (meanGainB - meanGainA) * morph;
 
+		if (meanGain * maxMakeupGain <= 1.0f)
+			return maxMakeupGain;
+
+		return 1.0f / meanGain;
+	}
+
+	// Jumps to the host position, or with tempo prediction steers the increment
+	// so the playhead converges on it during the block
+	void synchronizePlayhead(float &playhead, uint32_t rateParameter, PlayheadIncrement &state, uint32_t frames)
+	{
 		if (!bpmSync)
 			return;
 
@@ -325,131 +825,649 @@ class WolfLFO : public Plugin
 		const double ticksPerBeat = bbt.ticksPerBeat;
 		const float beatsPerBar = bbt.beatsPerBar;
 
-		const int lfoRateIndex = std::round(parameters[paramLFORate].getRawValue());
-		const float lfoRate = getLFORateInBars((LFORate)lfoRateIndex);
+		const float lfoRate = getSyncedLFORate(rateParameter);
 
 		const double beatsPerLFORotation = lfoRate * beatsPerBar;
 		const double percentOfBeatDone = beatTick / ticksPerBeat;
 		const float totalBeats = bar * beatsPerBar + beat + percentOfBeatDone;
 
-		PlayheadPos = std::fmod(totalBeats, beatsPerLFORotation) / beatsPerLFORotation;
+		float position = std::fmod(totalBeats, beatsPerLFORotation) / beatsPerLFORotation;
 
 		const float phase = parameters[paramPhase].getRawValue();
-		PlayheadPos += phase;
+		position += phase;
+
+		if (position > 1.0f)
+		{
+			position -= 1.0f;
+		}
+
+		if (predictTempo && getTimePosition().playing && frames > 0)
+		{
+			float error = position - playhead;
+			error -= std::round(error);
+
+			if (std::abs(error) <= maxPhaseError)
+			{
+				state.increment += error * phaseLockGain / frames;
+				return;
+			}
+		}
+
+		playhead = position;
+	}
+
+	// Tempo change per sample between the last two host reports,
+	// only tracked while tempo prediction is on and the transport rolls
+	void updateTempoSlope(uint32_t frames)
+	{
+		const TimePosition &timePos = getTimePosition();
+
+		tempoSlope = 0.0f;
 
-		if (PlayheadPos > 1.0f)
+		if (!predictTempo || !timePos.playing || !timePos.bbt.valid)
 		{
-			PlayheadPos -= 1.0f;
+			lastBeatsPerMinute = 0.0f;
+			return;
+		}
+
+		const float beatsPerMinute = timePos.bbt.beatsPerMinute;
+
+		if (lastBeatsPerMinute > 0.0f && lastBlockFrames > 0)
+		{
+			tempoSlope = (beatsPerMinute - lastBeatsPerMinute) / lastBlockFrames;
 		}
+
+		lastBeatsPerMinute = beatsPerMinute;
+		lastBlockFrames = frames;
 	}
 
-	void updatePlayheadPos()
+	float getSyncedLFORate(uint32_t rateParameter)
+	{
+		const int lfoRateIndex = std::round(parameters[rateParameter].getRawValue());
+		const int modifier = std::round(parameters[paramRateModifier].getRawValue());
+
+		return getLFORateInBars(lfoRateIndex, modifier);
+	}
+
+	// The tempo and the synced rates only change between blocks
+	void updateSyncedIncrement(PlayheadIncrement &state, uint32_t rateParameter)
 	{
 		const TimePosition &timePos = getTimePosition();
 
-		const bool bpmSync = std::round(parameters[paramBPMSync].getRawValue());
+		state.freeRate = -1.0f;
+		state.ramp = 0.0f;
 
+		if (!timePos.playing)
+		{
+			state.increment = 0.0f;
+			return;
+		}
+
+		const float lfoRate = getSyncedLFORate(rateParameter);
+		const float incrementPerBPM = samplePeriod / 60.f / (timePos.bbt.beatsPerBar * lfoRate);
+
+		state.increment = incrementPerBPM * timePos.bbt.beatsPerMinute;
+		state.ramp = incrementPerBPM * tempoSlope;
+	}
+
+	void updatePlayheadPos(float &playhead, uint32_t rateParameter, PlayheadIncrement &state)
+	{
 		if (bpmSync)
 		{
-			if (!timePos.playing)
-				return;
+			playhead += state.increment;
+			state.increment += state.ramp;
+		}
+		else
+		{
+			updateFreeIncrement(state, rateParameter);
+
+			playhead += state.increment;
+		}
+
+		if (playhead > 1.0f)
+		{
+			playhead -= 1.0f;
+		}
+		else if (playhead < 0.0f)
+		{
+			playhead += 1.0f;
+		}
+	}
+
+	void updateFreeIncrement(PlayheadIncrement &state, uint32_t rateParameter)
+	{
+		const float rate = parameters[rateParameter].getSmoothedValue();
+
+		if (rate != state.freeRate)
+		{
+			state.freeRate = rate;
+			state.increment = samplePeriod * getFreeLFORate(rate);
+		}
+	}
+
+	// pole^frames of the parameter smoothers, silent blocks mostly come in the same size
+	float getSmootherDecay(uint32_t frames)
+	{
+		if (frames != smootherDecayFrames)
+		{
+			smootherDecayFrames = frames;
+			smootherDecay = std::pow(smootherPole, (float)frames);
+		}
+
+		return smootherDecay;
+	}
+
+	// ParamSmooth moves by one sample per call, this moves it by a whole block in closed form.
+	// It is a one-pole, so after the first sample the value is target + (first - target) * pole^n.
+	// The first step is taken for real to read where the smoother is, a second one towards
+	// a shifted target lands on the last value, then the target is put back.
+	float skipSmoothedValue(uint32_t index, uint32_t frames, float &first)
+	{
+		const float target = parameters[index].getRawValue();
+
+		if (frames == 0)
+		{
+			first = target;
+			return target;
+		}
+
+		first = parameters[index].getSmoothedValue();
+
+		if (frames == 1)
+			return first;
+
+		const float last = target + (first - target) * getSmootherDecay(frames) / smootherPole;
+
+		parameters[index].setValue((last - smootherPole * first) / (1.0f - smootherPole));
+		parameters[index].getSmoothedValue();
+		parameters[index].setValue(target);
+
+		return last;
+	}
+
+	float skipSmoothedValue(uint32_t index, uint32_t frames)
+	{
+		float first;
+
+		return skipSmoothedValue(index, frames, first);
+	}
+
+	// Moves the playhead by a whole block at once, same result as calling
+	// updatePlayheadPos for each sample. A moving free rate is integrated
+	// exactly along the path of its smoother.
+	void advancePlayhead(float &playhead, uint32_t rateParameter, PlayheadIncrement &state, uint32_t frames)
+	{
+		if (bpmSync)
+		{
+			playhead += frames * state.increment + 0.5f * frames * (frames - 1.0f) * state.ramp;
+			state.increment += frames * state.ramp;
+		}
+		else if (frames > 0)
+		{
+			const float target = parameters[rateParameter].getRawValue();
+
+			float first;
+			const float last = skipSmoothedValue(rateParameter, frames, first);
+
+			playhead += samplePeriod * sumFreeLFORates(first, target, smootherPole, getSmootherDecay(frames), frames);
+
+			state.freeRate = last;
+			state.increment = samplePeriod * getFreeLFORate(last);
+		}
+
+		playhead -= std::floor(playhead);
+	}
+
+	// Counts how long the input stayed silent after the pre gain,
+	// from the peak of a processed block
+	void updateSilence(float inputPeak, uint32_t frames)
+	{
+		if (inputPeak > silenceThreshold)
+			silentSamples = 0;
+		else if (silentSamples < silenceTailSamples)
+			silentSamples += frames;
+	}
+
+	// True when the block can be skipped: the crossover tail has decayed, resuming
+	// won't continue a wet or post gain ramp and the input is still silent.
+	// The input is only scanned here once the rest holds, processed blocks
+	// meter it chunk by chunk as they go.
+	bool isSilentBlock(const float **inputs, uint32_t frames, float &inputPeak)
+	{
+		if (silentSamples < silenceTailSamples)
+			return false;
+
+		if (std::abs(lastWet - parameters[paramWet].getRawValue()) >= settledTolerance
+			|| std::abs(lastPostGain - parameters[paramPostGain].getRawValue()) >= settledTolerance)
+			return false;
+
+		inputPeak = Dsp::peak(2, frames, inputs);
+
+		if (inputPeak * parameters[paramPreGain].getRawValue() > silenceThreshold)
+		{
+			silentSamples = 0;
+			return false;
+		}
+
+		return true;
+	}
+
+	// Nothing is computed for the audio, but the parameters keep gliding and
+	// the playheads keep moving, so the next processed block starts where it
+	// would have without the skip
+	void skipSilentBlock(float **outputs, uint32_t frames, int bandCount)
+	{
+		std::fill(outputs[0], outputs[0] + frames, 0.0f);
+		std::fill(outputs[1], outputs[1] + frames, 0.0f);
+
+		warpAmount = skipSmoothedValue(paramHorizontalWarpAmount, frames);
+		lastWet = skipSmoothedValue(paramWet, frames);
+		lastPostGain = skipSmoothedValue(paramPostGain, frames);
+		skipSmoothedValue(paramPreGain, frames);
+		const float morph = skipSmoothedValue(paramMorph, frames);
 
-			const int lfoRateIndex = std::round(parameters[paramLFORate].getRawValue());
-			const float lfoRate = getLFORateInBars((LFORate)lfoRateIndex);
+		advancePlayhead(PlayheadPos, paramLFORate, playheadIncrement, frames);
 
-			PlayheadPos += 1.0f / getSampleRate() / 60.f * (timePos.bbt.beatsPerMinute / timePos.bbt.beatsPerBar) / lfoRate;
+		const float makeupGain = getMakeupGain();
+
+		if (bandCount > 1)
+		{
+			// whatever is left of the tail is below the silence threshold
+			crossover.reset();
+			linearPhaseCrossover.reset();
+
+			if (crossoverIsMoving)
+				updateCrossover(getSampleRate());
+
+			for (int b = 0; b < bandCount; ++b)
+			{
+				skipSmoothedValue(paramBandDepth1 + b, frames);
+				const float bandMorph = skipSmoothedValue(paramBandMorph1 + b, frames);
+				advancePlayhead(bandPlayheads[b], paramBandRate1 + b, bandIncrements[b], frames);
+
+				// the output smoothers would have caught up with the graph by now
+				bandOutputs[b].reset(getScaledGraphValue(bandPlayheads[b], bandMorph) * makeupGain);
+			}
 		}
 		else
 		{
-			const float lfoRate = getFreeLFORate(parameters[paramLFORate].getSmoothedValue());
+			graphOutput.reset(getScaledGraphValue(PlayheadPos, morph) * makeupGain);
+		}
+	}
+
+	// The playhead, the meters and the statistics of the edited shape, for the UI
+	void updateOutputParameters(uint32_t frames, float inputPeak, float inputEnergy, float outputPeak, float outputEnergy, float modulationDepth)
+	{
+		setParameterValue(paramPlayheadPos, PlayheadPos);
+
+		const float meteredSamples = 2.0f * std::max(frames, 1u);
+
+		setParameterValue(paramInputPeak, getLevelInDecibels(inputPeak));
+		setParameterValue(paramInputRMS, getLevelInDecibels(std::sqrt(inputEnergy / meteredSamples)));
+		setParameterValue(paramOutputPeak, getLevelInDecibels(outputPeak));
+		setParameterValue(paramOutputRMS, getLevelInDecibels(std::sqrt(outputEnergy / meteredSamples)));
+		setParameterValue(paramModulationDepth, std::max(0.0f, std::min(1.0f, modulationDepth)));
+
+		setParameterValue(paramShapeMin, slotStatistics[editedSlot].min);
+		setParameterValue(paramShapeMax, slotStatistics[editedSlot].max);
+		setParameterValue(paramShapeMean, slotStatistics[editedSlot].mean);
+		setParameterValue(paramShapeRMS, slotStatistics[editedSlot].rms);
+		setParameterValue(paramShapeIntegral, slotStatistics[editedSlot].integral);
+	}
+
+	void updateSmoothers(double sampleRate)
+	{
+		const wolf::SmoothingMode smoothingMode = (wolf::SmoothingMode)std::round(parameters[paramSmoothingMode].getRawValue());
+		const float smoothingFrequency = 44.1f - parameters[paramSmoothing].getRawValue();
+		const float riseTime = parameters[paramSlewRise].getRawValue();
+		const float fallTime = parameters[paramSlewFall].getRawValue();
+
+		graphOutput.setup(smoothingMode, smoothingFrequency, riseTime, fallTime, sampleRate);
+
+		for (int b = 0; b < maxBands; ++b)
+		{
+			bandOutputs[b].setup(smoothingMode, smoothingFrequency, riseTime, fallTime, sampleRate);
+		}
+
+		mustUpdateSmoothers = false;
+	}
+
+	// The band count, the crossover type or the sample rate changed, the filters
+	// start over so the frequencies jump to their parameters.
+	// The host is told about the latency of the linear phase crossover while it is used.
+	void updateCrossover(double sampleRate)
+	{
+		const int bandCount = std::round(parameters[paramBandCount].getRawValue());
+		const bool wasLinearPhase = linearPhase;
+
+		linearPhase = std::round(parameters[paramLinearPhase].getRawValue());
 
-			PlayheadPos += 1.0f / getSampleRate() * lfoRate;
+		for (int i = 0; i < maxBands - 1; ++i)
+		{
+			crossoverFrequencies[i] = parameters[paramCrossover1 + i].getRawValue();
 		}
 
-		if (PlayheadPos > 1.0f)
+		crossover.setup(bandCount, crossoverFrequencies, sampleRate);
+
+		if (linearPhase)
 		{
-			PlayheadPos -= 1.0f;
+			linearPhaseCrossover.setup(bandCount, crossoverFrequencies, sampleRate);
+
+			if (!wasLinearPhase)
+				linearPhaseCrossover.reset();
 		}
+
+		setLatency(linearPhase && bandCount > 1 ? linearPhaseCrossover.getLatency() : 0);
+
+		mustUpdateCrossover = false;
+		crossoverIsMoving = false;
 	}
 
-	void run(const float **inputs, float **outputs, uint32_t frames) override
+	// Moves the crossover frequencies one chunk towards their parameters
+	void glideCrossover(double sampleRate)
 	{
-		if (mutex.tryLock())
+		crossoverIsMoving = false;
+
+		for (int i = 0; i < maxBands - 1; ++i)
 		{
-			if (mustCopyLineEditor)
+			const float ratio = parameters[paramCrossover1 + i].getRawValue() / crossoverFrequencies[i];
+
+			if (std::abs(ratio - 1.0f) < crossoverSettledTolerance)
 			{
-				lineEditor = tempLineEditor;
+				crossoverFrequencies[i] = parameters[paramCrossover1 + i].getRawValue();
+			}
+			else
+			{
+				crossoverFrequencies[i] *= std::pow(ratio, crossoverGlideCoeff);
+				crossoverIsMoving = true;
+			}
+		}
 
-				for (int i = 0; i < lineEditor.getVertexCount(); ++i)
-				{
-					lineEditor.getVertexAtIndex(i)->setGraphPtr(&lineEditor);
-				}
+		crossover.setup(crossover.getBandCount(), crossoverFrequencies, sampleRate);
 
-				mustCopyLineEditor = false;
+		if (linearPhase)
+			linearPhaseCrossover.setup(crossover.getBandCount(), crossoverFrequencies, sampleRate);
+	}
+
+	void run(const float **inputs, float **outputs, uint32_t frames) override
+	{
+		const bool locked = mutex.tryLock();
+
+		if (locked)
+		{
+			for (int i = 0; i < graphSlotCount; ++i)
+			{
+				if (graphSlots[i].hasPendingGraph())
+					graphSlots[i].commitPendingGraph();
 			}
 		}
 
-		wolf::WarpType horizontalWarpType = (wolf::WarpType)std::round(parameters[paramHorizontalWarpType].getRawValue());
-		lineEditor.setHorizontalWarpType(horizontalWarpType);
+		updateShapes();
 
-		synchronizePlayhead();
+		bpmSync = std::round(parameters[paramBPMSync].getRawValue());
+		predictTempo = bpmSync && std::round(parameters[paramTempoPrediction].getRawValue());
 
-		const float smoothingFrequency = 44.1f - parameters[paramSmoothing].getRawValue();
-		graphOutput.calculateCoeff(smoothingFrequency, getSampleRate());
+		updateTempoSlope(frames);
+
+		if (bpmSync)
+			updateSyncedIncrement(playheadIncrement, paramLFORate);
 
-		for (uint32_t i = 0; i < frames; ++i)
+		synchronizePlayhead(PlayheadPos, paramLFORate, playheadIncrement, frames);
+
+		if (mustUpdateSmoothers)
+			updateSmoothers(getSampleRate());
+
+		if (mustUpdateCrossover)
+			updateCrossover(getSampleRate());
+
+		const int bandCount = crossover.getBandCount();
+
+		if (bandCount > 1)
 		{
-			lineEditor.setHorizontalWarpAmount(parameters[paramHorizontalWarpAmount].getSmoothedValue());
+			for (int b = 0; b < bandCount; ++b)
+			{
+				if (bpmSync)
+					updateSyncedIncrement(bandIncrements[b], paramBandRate1 + b);
+
+				synchronizePlayhead(bandPlayheads[b], paramBandRate1 + b, bandIncrements[b], frames);
+			}
+		}
+
+		float inputPeak = 0.0f;
+
+		if (isSilentBlock(inputs, frames, inputPeak))
+		{
+			// the input is far below the range of the meters, its RMS reads as the floor
+			skipSilentBlock(outputs, frames, bandCount);
+			updateOutputParameters(frames, inputPeak, 0.0f, 0.0f, 0.0f, 0.0f);
+
+			if (locked)
+				mutex.unlock();
+
+			return;
+		}
 
-			const float preGain = parameters[paramPreGain].getSmoothedValue();
+		const float makeupGain = getMakeupGain();
 
-			float inputL = preGain * inputs[0][i];
-			float inputR = preGain * inputs[1][i];
+		// both sides are measured one chunk at a time, while it is still in the cache
+		inputPeak = 0.0f;
+		float inputEnergy = 0.0f;
+		float outputPeak = 0.0f;
+		float outputEnergy = 0.0f;
 
-			if (inputL < 0.0f && inputL > -0.00001f)
+		// attenuation applied by the LFO on the last sample, boosts count as zero
+		float modulationDepth = 0.0f;
+
+		for (uint32_t chunkStart = 0; chunkStart < frames; chunkStart += processChunkFrames)
+		{
+			const uint32_t chunkFrames = std::min(frames - chunkStart, processChunkFrames);
+
+			const float *const sourcesL = inputs[0] + chunkStart;
+			const float *const sourcesR = inputs[1] + chunkStart;
+
+			// gain pass, buffered so the linear phase crossover can split the chunk at once
+			for (uint32_t i = 0; i < chunkFrames; ++i)
 			{
-				inputL = 0.0f;
+				const float preGain = parameters[paramPreGain].getSmoothedValue();
+
+				float inputL = preGain * sourcesL[i];
+				float inputR = preGain * sourcesR[i];
+
+				if (inputL < 0.0f && inputL > -0.00001f)
+				{
+					inputL = 0.0f;
+				}
+				if (inputR < 0.0f && inputR > -0.00001f)
+				{
+					inputR = 0.0f;
+				}
+
+				gainedInputs[0][i] = inputL;
+				gainedInputs[1][i] = inputR;
 			}
-			if (inputR < 0.0f && inputR > -0.00001f)
+
+			addLevels(sourcesL, sourcesR, chunkFrames, inputPeak, inputEnergy);
+
+			if (bandCount > 1 && crossoverIsMoving)
+				glideCrossover(getSampleRate());
+
+			if (bandCount > 1 && linearPhase)
 			{
-				inputR = 0.0f;
+				float *bandsL[maxBands];
+				float *bandsR[maxBands];
+
+				for (int b = 0; b < bandCount; ++b)
+				{
+					bandsL[b] = bandBuffers[0][b];
+					bandsR[b] = bandBuffers[1][b];
+				}
+
+				linearPhaseCrossover.process(gainedInputs[0], gainedInputs[1], chunkFrames, bandsL, bandsR);
 			}
 
-			const float rawGraphOutput = getGraphValue(PlayheadPos);
+			float *const outputsL = outputs[0] + chunkStart;
+			float *const outputsR = outputs[1] + chunkStart;
+
+			for (uint32_t i = 0; i < chunkFrames; ++i)
+			{
+				warpAmount = parameters[paramHorizontalWarpAmount].getSmoothedValue();
+
+				float inputL = gainedInputs[0][i];
+				float inputR = gainedInputs[1][i];
+
+				float outL;
+				float outR;
+
+				if (bandCount > 1)
+				{
+					// Each band follows its own playhead and morph through the graphs,
+					// the dry signal is the sum of the unmodulated bands
+					float bandL[maxBands];
+					float bandR[maxBands];
+
+					if (linearPhase)
+					{
+						for (int b = 0; b < bandCount; ++b)
+						{
+							bandL[b] = bandBuffers[0][b][i];
+							bandR[b] = bandBuffers[1][b][i];
+						}
+					}
+					else
+					{
+						crossover.process(inputL, inputR, bandL, bandR);
+					}
+
+					inputL = inputR = outL = outR = 0.0f;
+
+					float bandModulation = 0.0f;
+
+					for (int b = 0; b < bandCount; ++b)
+					{
+						const float bandMorph = parameters[paramBandMorph1 + b].getSmoothedValue();
+						const float depth = parameters[paramBandDepth1 + b].getSmoothedValue();
+
+						const float bandOutput = bandOutputs[b].process(getScaledGraphValue(bandPlayheads[b], bandMorph) * makeupGain);
+						const float gain = 1.0f + depth * (bandOutput - 1.0f);
+
+						inputL += bandL[b];
+						inputR += bandR[b];
+						outL += bandL[b] * gain;
+						outR += bandR[b] * gain;
+						bandModulation += 1.0f - gain;
+
+						updatePlayheadPos(bandPlayheads[b], paramBandRate1 + b, bandIncrements[b]);
+					}
+
+					modulationDepth = bandModulation / bandCount;
+				}
+				else
+				{
+					const float morph = parameters[paramMorph].getSmoothedValue();
+
+					const float smoothedOutput = graphOutput.process(getScaledGraphValue(PlayheadPos, morph) * makeupGain);
 
-			const double euler = std::exp(1.0);
-			const float scaledOutput = (std::exp(rawGraphOutput) - 1) / (euler - 1);
+					outL = inputL * smoothedOutput;
+					outR = inputR * smoothedOutput;
 
-			graphOutput.setValue(scaledOutput);
-			const float smoothedOutput = graphOutput.getSmoothedValue();
+					modulationDepth = 1.0f - smoothedOutput;
+				}
 
-			const float outL = inputL * smoothedOutput;
-			const float outR = inputR * smoothedOutput;
+				const float wet = parameters[paramWet].getSmoothedValue();
+				const float dry = 1.0f - wet;
+				const float postGain = parameters[paramPostGain].getSmoothedValue();
 
-			const float wet = parameters[paramWet].getSmoothedValue();
-			const float dry = 1.0f - wet;
-			const float postGain = parameters[paramPostGain].getSmoothedValue();
+				const float left = (dry * inputL + wet * outL) * postGain;
+				const float right = (dry * inputR + wet * outR) * postGain;
 
-			outputs[0][i] = (dry * inputL + wet * outL) * postGain;
-			outputs[1][i] = (dry * inputR + wet * outR) * postGain;
+				outputsL[i] = left;
+				outputsR[i] = right;
 
-			updatePlayheadPos();
+				modulationDepth *= wet;
+
+				lastWet = wet;
+				lastPostGain = postGain;
+
+				updatePlayheadPos(PlayheadPos, paramLFORate, playheadIncrement);
+			}
+
+			addLevels(outputsL, outputsR, chunkFrames, outputPeak, outputEnergy);
 		}
 
-		setParameterValue(paramPlayheadPos, PlayheadPos);
+		updateSilence(inputPeak * parameters[paramPreGain].getRawValue(), frames);
+		updateOutputParameters(frames, inputPeak, inputEnergy, outputPeak, outputEnergy, modulationDepth);
 
-		mutex.unlock();
+		if (locked)
+			mutex.unlock();
 	}
 
   private:
 	ParamSmooth parameters[paramCount];
-	ParamSmooth graphOutput;
+	wolf::OutputSmoother graphOutput;
+
+	// A and B graphs, crossfaded by the morph parameters
+	wolf::ShapeSlot graphSlots[graphSlotCount];
+
+	// serialized graphs of the slots, reported by getState()
+	String graphStates[graphSlotCount];
+
+	// the slot shown in the editor, which the "graph" state holds
+	int editedSlot;
+
+	// warp of the current sample, the warped tables are bypassed while it moves
+	wolf::WarpType horizontalWarpType;
+	float warpAmount;
+	bool warpIsMoving;
 
-	wolf::Graph lineEditor;
-	wolf::Graph tempLineEditor;
-	bool mustCopyLineEditor;
+	// of each slot with the current warp, updated every block
+	wolf::ShapeStatistics slotStatistics[graphSlotCount];
 
 	float PlayheadPos;
+	PlayheadIncrement playheadIncrement;
+
+	// playhead increment per sample is samplePeriod times the rate
+	float samplePeriod;
+
+	// read once per block, the synced increments are only valid while it is set
+	bool bpmSync;
+
+	// Tempo prediction, extrapolates the host tempo from its last two reports
+	bool predictTempo;
+	float lastBeatsPerMinute;
+	uint32_t lastBlockFrames;
+	float tempoSlope;
+
+	// pole of the parameter smoothers, and its power for the last skipped block size
+	float smootherPole;
+	uint32_t smootherDecayFrames;
+	float smootherDecay;
+
+	// Silence skipping, the last wet and post gain values tell if their smoothers settled
+	uint32_t silentSamples;
+	uint32_t silenceTailSamples;
+	float lastWet;
+	float lastPostGain;
+
+	// set when a parameter that feeds them changed
+	bool mustUpdateSmoothers;
+	bool mustUpdateCrossover;
+
+	// Multiband mode, each band has its own playhead and smoothed output
+	wolf::CrossoverBank crossover;
+	float crossoverFrequencies[maxBands - 1];
+	bool crossoverIsMoving;
+	float crossoverGlideCoeff;
+
+	// Linear phase alternative to the crossover bank, it splits whole chunks
+	// of the pre gained input into the band buffers
+	bool linearPhase;
+	wolf::LinearPhaseCrossover linearPhaseCrossover;
+	float gainedInputs[2][processChunkFrames];
+	float bandBuffers[2][maxBands][processChunkFrames];
+
+	wolf::OutputSmoother bandOutputs[maxBands];
+	float bandPlayheads[maxBands];
+	PlayheadIncrement bandIncrements[maxBands];
 
 	Mutex mutex;
 
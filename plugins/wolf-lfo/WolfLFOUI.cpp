@@ -4,8 +4,10 @@
 #include "Window.hpp"
 #include "Config.hpp"
 #include "Layout.hpp"
+#include "GraphState.hpp"
 #include "Fonts/chivo_bold.hpp"
 
+#include <algorithm>
 #include <string>
 
 #if defined(DISTRHO_OS_WINDOWS)
@@ -15,6 +17,7 @@
 START_NAMESPACE_DISTRHO
 
 WolfLFOUI::WolfLFOUI() : UI(611, 662),
+                         fEditedSlot(0),
                          fBottomBarVisible(true)
 {
     const uint minWidth = 611;
@@ -39,6 +42,12 @@ WolfLFOUI::WolfLFOUI() : UI(611, 662),
 
     fGraphWidget = new GraphWidget(this, Size<uint>(width - 4 * 2, height - 4 * 2 - 122));
 
+    fSecondGraphWidget = new GraphWidget(this, Size<uint>(width - 4 * 2, height - 4 * 2 - 122));
+    fSecondGraphWidget->setVisible(false);
+
+    fSlotGraphWidgets[0] = fGraphWidget;
+    fSlotGraphWidgets[1] = fSecondGraphWidget;
+
     const float graphBarHeight = 42;
 
     fGraphBar = new WidgetBar(this, Size<uint>(width, graphBarHeight));
@@ -116,6 +125,24 @@ WolfLFOUI::WolfLFOUI() : UI(611, 662),
     fLabelButtonResetGraph->setAlign(ALIGN_LEFT | ALIGN_MIDDLE);
     fLabelButtonResetGraph->setMargin(Margin(6, 0, std::round(fButtonResetGraph->getHeight() / 2.0f) + 1, 0));
 
+    fLabelImportGraph = new NanoLabel(this, Size<uint>(60, fButtonResetGraph->getHeight()));
+    fLabelImportGraph->setText("IMPORT");
+    fLabelImportGraph->setFontId(dejaVuSansId);
+    fLabelImportGraph->setFontSize(15.0f);
+    fLabelImportGraph->setAlign(ALIGN_LEFT | ALIGN_MIDDLE);
+    fLabelImportGraph->setMargin(Margin(6, 0, std::round(fButtonResetGraph->getHeight() / 2.0f) + 1, 0));
+
+    fLabelListGraphSlot = new LabelBoxList(this, Size<uint>(knobsLabelBoxWidth + 3, knobsLabelBoxHeight));
+    fLabelListGraphSlot->setLabels({"GRAPH A", "GRAPH B"});
+
+    fButtonLeftArrowGraphSlot = new ArrowButton(this, Size<uint>(knobsLabelBoxHeight, knobsLabelBoxHeight));
+    fButtonLeftArrowGraphSlot->setCallback(this);
+    fButtonLeftArrowGraphSlot->setArrowDirection(ArrowButton::Left);
+
+    fButtonRightArrowGraphSlot = new ArrowButton(this, Size<uint>(knobsLabelBoxHeight, knobsLabelBoxHeight));
+    fButtonRightArrowGraphSlot->setCallback(this);
+    fButtonRightArrowGraphSlot->setArrowDirection(ArrowButton::Right);
+
     positionWidgets(width, height);
 }
 
@@ -161,8 +188,11 @@ void WolfLFOUI::positionWidgets(uint width, uint height)
     const float graphBarHeight = fGraphBar->getHeight();
     const float graphBarMargin = 6;
 
-    fGraphWidget->setSize(width - graphMargin * 2, height - graphMargin * 2 - bottomBarSize - graphBarHeight);
-    fGraphWidget->setAbsolutePos(graphMargin, graphMargin);
+    for (int i = 0; i < 2; ++i)
+    {
+        fSlotGraphWidgets[i]->setSize(width - graphMargin * 2, height - graphMargin * 2 - bottomBarSize - graphBarHeight);
+        fSlotGraphWidgets[i]->setAbsolutePos(graphMargin, graphMargin);
+    }
 
     const float graphBottom = fGraphWidget->getAbsoluteY() + fGraphWidget->getHeight();
 
@@ -179,6 +209,11 @@ void WolfLFOUI::positionWidgets(uint width, uint height)
 
     fButtonResetGraph->setAbsolutePos(20, graphBarMiddleY - fButtonResetGraph->getHeight() / 2.0f);
     fLabelButtonResetGraph->setAbsolutePos(fButtonResetGraph->getAbsoluteX() + fButtonResetGraph->getWidth(), fButtonResetGraph->getAbsoluteY());
+    fLabelImportGraph->setAbsolutePos(fLabelButtonResetGraph->getAbsoluteX() + fLabelButtonResetGraph->getWidth() + 10, fButtonResetGraph->getAbsoluteY());
+
+    fButtonRightArrowGraphSlot->setAbsolutePos(width - 20 - fButtonRightArrowGraphSlot->getWidth(), graphBarMiddleY - fButtonRightArrowGraphSlot->getHeight() / 2.0f);
+    fLabelListGraphSlot->setAbsolutePos(fButtonRightArrowGraphSlot->getAbsoluteX() - fLabelListGraphSlot->getWidth(), fButtonRightArrowGraphSlot->getAbsoluteY());
+    fButtonLeftArrowGraphSlot->setAbsolutePos(fLabelListGraphSlot->getAbsoluteX() - fButtonLeftArrowGraphSlot->getWidth(), fLabelListGraphSlot->getAbsoluteY());
 
     float centerAlignDifference = (fLabelPreGain->getWidth() - fKnobPreGain->getWidth()) / 2.0f;
 
@@ -227,6 +262,7 @@ void WolfLFOUI::parameterChanged(uint32_t index, float value)
         const int warpType = std::round(value);
 
         fGraphWidget->setHorizontalWarpType((wolf::WarpType)warpType);
+        fSecondGraphWidget->setHorizontalWarpType((wolf::WarpType)warpType);
         fLabelListHorizontalWarpType->setSelectedIndex(warpType);
 
         break;
@@ -234,9 +270,11 @@ void WolfLFOUI::parameterChanged(uint32_t index, float value)
     case paramHorizontalWarpAmount:
         fKnobHorizontalWarp->setValue(value);
         fGraphWidget->setHorizontalWarpAmount(value);
+        fSecondGraphWidget->setHorizontalWarpAmount(value);
         break;
     case paramPlayheadPos:
         fGraphWidget->updateInput(value);
+        fSecondGraphWidget->updateInput(value);
         break;
     default:
         break;
@@ -245,8 +283,42 @@ void WolfLFOUI::parameterChanged(uint32_t index, float value)
 
 void WolfLFOUI::stateChanged(const char *key, const char *value)
 {
-    if (std::strcmp(key, "graph") == 0)
-        fGraphWidget->rebuildFromString(value);
+    if (std::strcmp(key, "graph") == 0 && wolf::validateGraphState(value))
+    {
+        fSlotGraphWidgets[fEditedSlot]->rebuildFromString(value);
+    }
+    else if (std::strcmp(key, "graphB") == 0 && wolf::validateGraphState(value))
+    {
+        fSlotGraphWidgets[1 - fEditedSlot]->rebuildFromString(value);
+    }
+    else if (std::strcmp(key, "graphslot") == 0)
+    {
+        //the visible editor keeps holding the "graph" state, only its slot changes
+        const int slot = std::strcmp(value, "B") == 0 ? 1 : 0;
+
+        if (slot != fEditedSlot)
+        {
+            std::swap(fSlotGraphWidgets[0], fSlotGraphWidgets[1]);
+            fEditedSlot = slot;
+            fLabelListGraphSlot->setSelectedIndex(slot);
+        }
+    }
+
+    repaint();
+}
+
+void WolfLFOUI::selectGraphSlot(int slot)
+{
+    if (slot == fEditedSlot)
+        return;
+
+    //the graph widgets only write the "graph" state, the plugin routes it to the selected slot
+    setState("selectslot", slot == 0 ? "A" : "B");
+
+    fSlotGraphWidgets[fEditedSlot]->setVisible(false);
+    fSlotGraphWidgets[slot]->setVisible(true);
+
+    fEditedSlot = slot;
 
     repaint();
 }
@@ -294,9 +366,36 @@ bool WolfLFOUI::onMouse(const MouseEvent &ev)
 {
     WolfLFOConfig::load();
 
+    if (ev.press && ev.button == 1 && fLabelImportGraph->getAbsoluteArea().contains(ev.pos))
+    {
+        Window::FileBrowserOptions options;
+        options.title = "Import an envelope into the graph";
+
+        getParentWindow().openFileBrowser(options);
+
+        return true;
+    }
+
     return false;
 }
 
+void WolfLFOUI::uiFileBrowserSelected(const char *filename)
+{
+    if (filename == nullptr)
+        return;
+
+    // the whole file is folded onto the graph, which keeps the import to a single click
+    const char *graph = fEnvelopeFitter.fitFile(filename, 0.0, 0.02f);
+
+    if (graph == nullptr)
+        return;
+
+    fSlotGraphWidgets[fEditedSlot]->rebuildFromString(graph);
+    setState("graph", graph);
+
+    repaint();
+}
+
 void WolfLFOUI::uiReshape(uint width, uint height)
 {
     //setSize(width, height);
@@ -320,7 +419,18 @@ void WolfLFOUI::nanoButtonClicked(NanoButton *nanoButton)
 {
     if (nanoButton == fButtonResetGraph)
     {
-        fGraphWidget->reset();
+        fSlotGraphWidgets[fEditedSlot]->reset();
+        return;
+    }
+
+    if (nanoButton == fButtonLeftArrowGraphSlot || nanoButton == fButtonRightArrowGraphSlot)
+    {
+        if (nanoButton == fButtonLeftArrowGraphSlot)
+            fLabelListGraphSlot->goPrevious();
+        else
+            fLabelListGraphSlot->goNext();
+
+        selectGraphSlot(fLabelListGraphSlot->getSelectedIndex());
         return;
     }
 
@@ -337,6 +447,7 @@ void WolfLFOUI::nanoButtonClicked(NanoButton *nanoButton)
 
     setParameterValue(paramHorizontalWarpType, index);
     fGraphWidget->setHorizontalWarpType((wolf::WarpType)index);
+    fSecondGraphWidget->setHorizontalWarpType((wolf::WarpType)index);
 }
 
 void WolfLFOUI::nanoWheelValueChanged(NanoWheel *nanoWheel, const int value)
@@ -353,6 +464,7 @@ void WolfLFOUI::nanoKnobValueChanged(NanoKnob *nanoKnob, const float value)
     if (id == paramHorizontalWarpAmount)
     {
         fGraphWidget->setHorizontalWarpAmount(value);
+        fSecondGraphWidget->setHorizontalWarpAmount(value);
     }
 }
 
@@ -16,6 +16,7 @@
 #include "WidgetBar.hpp"
 #include "ArrowButton.hpp"
 #include "LabelBoxList.hpp"
+#include "EnvelopeFitter.hpp"
 
 START_NAMESPACE_DISTRHO
 
@@ -50,9 +51,11 @@ protected:
   void uiReshape(uint width, uint height) override;
   bool onKeyboard(const KeyboardEvent &ev) override;
   bool onMouse(const MouseEvent &ev) override;
+  void uiFileBrowserSelected(const char *filename) override;
 
 private:
   void toggleBottomBarVisibility();
+  void selectGraphSlot(int slot);
 
   ScopedPointer<RemoveDCSwitch> fSwitchBPMSync;
   ScopedPointer<NanoLabel> fLabelBPMSync;
@@ -67,10 +70,20 @@ private:
 
   ScopedPointer<ResizeHandle> fHandleResize;
 
-  ScopedPointer<GraphWidget> fGraphWidget;
+  // one editor per graph slot, only the edited one is visible
+  ScopedPointer<GraphWidget> fGraphWidget, fSecondGraphWidget;
+  GraphWidget *fSlotGraphWidgets[2];
+  int fEditedSlot;
+
+  ScopedPointer<LabelBoxList> fLabelListGraphSlot;
+  ScopedPointer<ArrowButton> fButtonLeftArrowGraphSlot, fButtonRightArrowGraphSlot;
+
   ScopedPointer<WidgetBar> fGraphBar;
   ScopedPointer<ResetGraphButton> fButtonResetGraph;
   ScopedPointer<NanoLabel> fLabelButtonResetGraph;
+  ScopedPointer<NanoLabel> fLabelImportGraph;
+
+  wolf::EnvelopeFitter fEnvelopeFitter;
 
   bool fBottomBarVisible;
 